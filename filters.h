@@ -0,0 +1,128 @@
+// Потоковые фильтры для показаний датчиков. Размер окна задается параметром
+// шаблона, память выделяется статически, каждый фильтр обрабатывает по одному
+// значению за вызов без сортировки всего окна.
+#pragma once
+
+#include <algorithm>
+#include <math.h>
+#include <stddef.h>
+#include <type_traits>
+
+// Скользящая медиана по последним N значениям. Помимо кольцевого буфера
+// хранится отсортированная копия окна: старое значение находится в ней
+// двоичным поиском и удаляется, новое вставляется на свое место.
+// Поиск O(log N), сдвиг элементов - O(N) копирований (при малых N это memmove
+// нескольких слов вместо полной сортировки).
+template <typename T, size_t N>
+class SlidingMedian {
+public:
+  static_assert(N > 0, "SlidingMedian window must not be empty");
+
+  void push(T value) {
+    if (count_ == N) {
+      erase(ring_[head_]);
+    }
+    ring_[head_] = value;
+    head_ = (head_ + 1) % N;
+    insert(value);
+  }
+
+  // Медиана окна (при четном количестве - верхняя из двух средних)
+  T value() const { return sorted_[count_ / 2]; }
+  T oldest() const { return ring_[(head_ + N - count_) % N]; }
+  size_t size() const { return count_; }
+  bool empty() const { return count_ == 0; }
+
+  void reset() {
+    count_ = 0;
+    head_ = 0;
+  }
+
+  // Значения окна по возрастанию
+  const T *sorted() const { return sorted_; }
+
+private:
+  void insert(T value) {
+    T *pos = std::upper_bound(sorted_, sorted_ + count_, value);
+    std::move_backward(pos, sorted_ + count_, sorted_ + count_ + 1);
+    *pos = value;
+    count_++;
+  }
+
+  void erase(T value) {
+    T *pos = std::lower_bound(sorted_, sorted_ + count_, value);
+    std::move(pos + 1, sorted_ + count_, pos);
+    count_--;
+  }
+
+  T ring_[N];
+  T sorted_[N];
+  size_t head_ = 0;
+  size_t count_ = 0;
+};
+
+// Фильтр Хампеля: значение, отстоящее от медианы окна больше чем на
+// threshold * MAD (медиана абсолютных отклонений, приведенная к σ),
+// считается выбросом и заменяется медианой. Исходное значение все равно
+// попадает в окно, поэтому устойчивый сдвиг уровня принимается через N/2 шагов.
+// Медиана берется из SlidingMedian, MAD - выбором n-го элемента, O(N).
+template <typename T, size_t N>
+class HampelFilter {
+public:
+  static_assert(N >= 3, "HampelFilter needs at least 3 samples");
+
+  // minDeviation - отклонение, которое выбросом не считается никогда
+  // (иначе при неизменном сигнале MAD = 0 и выбросом будет любой шаг)
+  HampelFilter(float threshold = 3.0f, T minDeviation = T()) : threshold_(threshold), minDeviation_(minDeviation) {}
+
+  T update(T value) {
+    T result = value;
+    if (window_.size() >= 3) {
+      T median = window_.value();
+      float deviations[N];
+      const T *values = window_.sorted();
+      for (size_t i = 0; i < window_.size(); i++) {
+        deviations[i] = fabsf((float)values[i] - (float)median);
+      }
+      size_t middle = window_.size() / 2;
+      std::nth_element(deviations, deviations + middle, deviations + window_.size());
+      float limit = std::max(threshold_ * 1.4826f * deviations[middle], (float)minDeviation_);
+      if (fabsf((float)value - (float)median) > limit) {
+        result = median;
+        rejected_++;
+      }
+    }
+    window_.push(value);
+    return result;
+  }
+
+  unsigned long rejected() const { return rejected_; }
+
+private:
+  SlidingMedian<T, N> window_;
+  float threshold_;
+  T minDeviation_;
+  unsigned long rejected_ = 0;
+};
+
+// Экспоненциальное скользящее среднее, O(1). Первое значение принимается как есть.
+template <typename T>
+class EmaFilter {
+public:
+  explicit EmaFilter(float alpha) : alpha_(alpha) {}
+
+  T update(T value) {
+    state_ = initialized_ ? state_ + alpha_ * ((float)value - state_) : (float)value;
+    initialized_ = true;
+    return this->value();
+  }
+
+  // Целые округляются к ближайшему в обе стороны от нуля
+  T value() const { return std::is_integral<T>::value ? (T)lroundf(state_) : (T)state_; }
+  bool initialized() const { return initialized_; }
+
+private:
+  float alpha_;
+  float state_ = 0;
+  bool initialized_ = false;
+};
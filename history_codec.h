@@ -0,0 +1,290 @@
+// Формат сжатых блоков истории: запись HistoryRecord, битовый кодировщик,
+// потоковый декодер и раскладка блоков во флеше. Зависит только от стандартной
+// библиотеки, поэтому проверяется и измеряется на компьютере
+// (tests/history_codec_test.cpp, tests/history_codec_bench.cpp).
+#pragma once
+
+#include <algorithm>
+#include <stdint.h>
+#include <stdlib.h>
+
+#ifndef HISTORY_BLOCK_SIZE
+#define HISTORY_BLOCK_SIZE 260       // байт в сжатом блоке истории (блок с CRC - 272 байта)
+#endif
+#define HISTORY_RECORD_MAX_BITS 88   // худший случай для одной сжатой записи
+#define HISTORY_BLOCK_MAX_RECORDS 512 // записи открытого блока копятся во флеше по одной (8 КБ)
+#define HISTORY_NO_VALUE INT16_MIN
+#define HISTORY_NO_HUMIDITY 0xFFFF
+#define HISTORY_RAIN_LEVEL_MASK 0x00FF
+#define HISTORY_RAIN_LEVEL_SHIFT 4   // уровень дождя = rainValue / 16
+#define HISTORY_RAIN_FLAG 0x8000
+#define HISTORY_LOG_SECTOR_SIZE 4096
+
+// Компактная запись истории (10 байт). Время хранится как Unix-время
+// и форматируется только при выводе, показания - в фиксированной точке.
+struct __attribute__((packed)) HistoryRecord {
+  uint32_t epoch;        // 0, если время не было синхронизировано
+  int16_t temperature;   // сотые доли °C, HISTORY_NO_VALUE - нет данных
+  uint16_t humidity;     // десятые доли %, HISTORY_NO_HUMIDITY - нет данных
+  uint16_t rain;         // биты 0-7: уровень rainValue / 16, бит 15: идет дождь
+};
+static_assert(sizeof(HistoryRecord) == 10, "HistoryRecord layout changed");
+
+// Сжатое хранение истории в памяти и во флеше. Показания меняются медленно
+// (DHT11 - шагами по 1 °C и 1 %), поэтому каждая запись кодируется битовыми
+// полями относительно предыдущей:
+//   признак   - 0: время по расписанию и дождь без изменений, оба поля пропущены | 1: оба записаны
+//   время     - разность разностей: 0 | 10+7 бит | 110+9 бит | 1110+12 бит | 1111+32 бита (само время)
+//   темпер.,  - отклонение от прогноза в шагах датчика: 0 | 10+1 бит | 110+2 бита |
+//   влажность   1110+4 бита | 1111+16 бит (само значение)
+//   дождь     - 0 (без изменений) | 10+1 бит (уровень ±1) | 11+1+8 бит (флаг и уровень)
+// Шаг датчика - НОД уже встреченных разностей (100 для DHT11, 10 для DHT22).
+// Прогноз - прошлое значение или прошлое значение плюс прошлая разность: из
+// двух выбирается тот, что недавно ошибался меньше, так что шум DHT11 и плавный
+// ход DHT22 стоят по 1-3 бита. Отклонения в zig-zag. Блок декодируется только
+// с начала, каждый блок начинается с нулевого состояния, поэтому вытеснение
+// блока ничего не ломает.
+struct HistoryBlock {
+  uint32_t firstSeq;
+  uint16_t count;
+  uint16_t bitLength;
+  uint8_t data[HISTORY_BLOCK_SIZE];
+};
+
+// Состояние одного показания: прошлое значение, разность и шаг датчика
+struct HistorySeriesState {
+  int32_t value;      // прошлое значение, в т.ч. "нет данных"
+  int32_t delta;      // прошлая разность между двумя значениями подряд
+  uint16_t unit;      // шаг датчика, 0 - еще неизвестен
+  uint16_t cost[2];   // сглаженная ошибка прогноза: без разности и с разностью
+  bool known;         // value - настоящее значение, а не "нет данных"
+};
+
+// Последняя запись и шаг времени - база для кодирования следующей
+struct HistoryCodecState {
+  uint32_t epoch;
+  int64_t epochDelta;
+  HistorySeriesState temperature;
+  HistorySeriesState humidity;
+  uint16_t rain;
+};
+
+// Блок закрывается, когда следующая запись может в него не поместиться
+static inline bool historyBlockFull(const HistoryBlock &block) {
+  return block.bitLength + HISTORY_RECORD_MAX_BITS > HISTORY_BLOCK_SIZE * 8 || block.count >= HISTORY_BLOCK_MAX_RECORDS;
+}
+
+// Раскладка журнала истории во флеше: сегмент (сектор) из заголовка и
+// HISTORY_LOG_BLOCKS закрытых блоков с CRC. Записи открытого блока лежат
+// отдельно, по одной HistoryLogEntry, пока блок не будет закрыт.
+struct HistoryLogHeader {
+  uint32_t magic;
+  uint32_t segmentSeq;   // растет с каждым новым сегментом
+  uint32_t firstSeq;     // номер первой записи первого блока сегмента
+  uint32_t crc;          // CRC32 предыдущих полей
+};
+
+struct HistoryLogBlock {
+  HistoryBlock block;    // block.firstSeq 0xFFFFFFFF - позиция свободна (стертый флеш)
+  uint32_t crc;          // CRC32 блока
+};
+
+struct __attribute__((packed)) HistoryLogEntry {
+  uint32_t seq;          // 0xFFFFFFFF - позиция свободна (стертый флеш)
+  HistoryRecord record;
+  uint16_t crc;          // CRC16 предыдущих полей
+};
+
+#define HISTORY_LOG_BLOCKS ((HISTORY_LOG_SECTOR_SIZE - sizeof(HistoryLogHeader)) / sizeof(HistoryLogBlock))
+static_assert(sizeof(HistoryLogEntry) == 16, "HistoryLogEntry layout changed");
+static_assert(HISTORY_LOG_BLOCKS >= 1, "HISTORY_BLOCK_SIZE is too large for a flash segment");
+
+static inline uint32_t zigzagEncode(int32_t value) {
+  return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+static inline int32_t zigzagDecode(uint32_t value) {
+  return (int32_t)(value >> 1) ^ -(int32_t)(value & 1);
+}
+
+// Биты пишутся старшими вперед
+inline void writeHistoryBits(HistoryBlock &block, uint32_t value, uint8_t bits) {
+  while (bits > 0) {
+    uint16_t byteIndex = block.bitLength >> 3;
+    uint8_t used = block.bitLength & 7;
+    uint8_t take = std::min<uint8_t>(bits, 8 - used);
+    uint8_t chunk = (value >> (bits - take)) & ((1 << take) - 1);
+    if (used == 0) block.data[byteIndex] = 0;
+    block.data[byteIndex] |= chunk << (8 - used - take);
+    block.bitLength += take;
+    bits -= take;
+  }
+}
+
+inline uint32_t readHistoryBits(const HistoryBlock &block, uint16_t &bitPos, uint8_t bits) {
+  uint32_t value = 0;
+  while (bits > 0) {
+    uint8_t used = bitPos & 7;
+    uint8_t take = std::min<uint8_t>(bits, 8 - used);
+    uint8_t chunk = (block.data[bitPos >> 3] >> (8 - used - take)) & ((1 << take) - 1);
+    value = (value << take) | chunk;
+    bitPos += take;
+    bits -= take;
+  }
+  return value;
+}
+
+static inline int32_t historySeriesPrediction(const HistorySeriesState &series) {
+  return series.known && series.cost[1] < series.cost[0] ? series.value + series.delta : series.value;
+}
+
+// Одинаково вызывается кодировщиком и декодером после каждого значения
+inline void historySeriesUpdate(HistorySeriesState &series, int32_t value, int32_t missing) {
+  bool present = value != missing;
+  if (present && series.known) {
+    int32_t delta = value - series.value;
+    uint32_t unit = series.unit ? series.unit : 1;
+    uint32_t errors[2] = {(uint32_t)abs(delta) / unit, (uint32_t)abs(delta - series.delta) / unit};
+    for (int i = 0; i < 2; i++) {
+      series.cost[i] = series.cost[i] - (series.cost[i] >> 2) + std::min<uint32_t>(errors[i], 1000);
+    }
+    uint32_t a = series.unit, b = abs(delta);
+    while (b != 0) {
+      uint32_t r = a % b;
+      a = b;
+      b = r;
+    }
+    series.unit = (uint16_t)a;
+    series.delta = delta;
+  } else {
+    series.delta = 0;
+  }
+  series.value = value;
+  series.known = present;
+}
+
+inline void encodeHistoryValue(HistoryBlock &block, HistorySeriesState &series, int32_t value, int32_t missing) {
+  int32_t residual = value - historySeriesPrediction(series);
+  uint32_t zz = UINT32_MAX;
+  if (residual == 0) {
+    zz = 0;
+  } else if (series.known && value != missing && series.unit != 0 && residual % series.unit == 0) {
+    zz = zigzagEncode(residual / series.unit);
+  }
+  if (zz == 0) {
+    writeHistoryBits(block, 0b0, 1);
+  } else if (zz < 3) {
+    writeHistoryBits(block, 0b10, 2);
+    writeHistoryBits(block, zz - 1, 1);
+  } else if (zz < 7) {
+    writeHistoryBits(block, 0b110, 3);
+    writeHistoryBits(block, zz - 3, 2);
+  } else if (zz < 23) {
+    writeHistoryBits(block, 0b1110, 4);
+    writeHistoryBits(block, zz - 7, 4);
+  } else {
+    writeHistoryBits(block, 0b1111, 4);
+    writeHistoryBits(block, (uint16_t)value, 16);
+  }
+  historySeriesUpdate(series, value, missing);
+}
+
+// raw - значение, прочитанное целиком (16 бит), приводится к типу поля
+template <typename T>
+inline T decodeHistoryValue(const HistoryBlock &block, uint16_t &bitPos, HistorySeriesState &series, int32_t missing) {
+  int32_t predicted = historySeriesPrediction(series);
+  T value;
+  if (readHistoryBits(block, bitPos, 1) == 0) {
+    value = (T)predicted;
+  } else if (readHistoryBits(block, bitPos, 1) == 0) {
+    value = (T)(predicted + zigzagDecode(readHistoryBits(block, bitPos, 1) + 1) * series.unit);
+  } else if (readHistoryBits(block, bitPos, 1) == 0) {
+    value = (T)(predicted + zigzagDecode(readHistoryBits(block, bitPos, 2) + 3) * series.unit);
+  } else if (readHistoryBits(block, bitPos, 1) == 0) {
+    value = (T)(predicted + zigzagDecode(readHistoryBits(block, bitPos, 4) + 7) * series.unit);
+  } else {
+    value = (T)readHistoryBits(block, bitPos, 16);
+  }
+  historySeriesUpdate(series, value, missing);
+  return value;
+}
+
+inline void encodeHistoryRecord(HistoryBlock &block, HistoryCodecState &state, const HistoryRecord &entry) {
+  int64_t delta = (int64_t)entry.epoch - state.epoch;
+  int64_t deltaOfDelta = delta - state.epochDelta;
+  uint32_t zz = deltaOfDelta >= INT32_MIN && deltaOfDelta <= INT32_MAX ? zigzagEncode((int32_t)deltaOfDelta) : UINT32_MAX;
+  uint16_t rainFlag = entry.rain & HISTORY_RAIN_FLAG;
+  int level = entry.rain & HISTORY_RAIN_LEVEL_MASK;
+  int previousLevel = state.rain & HISTORY_RAIN_LEVEL_MASK;
+  bool steady = zz == 0 && (uint16_t)(rainFlag | level) == state.rain;
+  
+  writeHistoryBits(block, steady ? 0 : 1, 1);
+  if (!steady) {
+    if (zz == 0) {
+      writeHistoryBits(block, 0b0, 1);
+    } else if (zz < (1 << 7)) {
+      writeHistoryBits(block, 0b10, 2);
+      writeHistoryBits(block, zz, 7);
+    } else if (zz < (1 << 9)) {
+      writeHistoryBits(block, 0b110, 3);
+      writeHistoryBits(block, zz, 9);
+    } else if (zz < (1 << 12)) {
+      writeHistoryBits(block, 0b1110, 4);
+      writeHistoryBits(block, zz, 12);
+    } else {
+      writeHistoryBits(block, 0b1111, 4);
+      writeHistoryBits(block, entry.epoch, 32);
+    }
+  }
+  
+  encodeHistoryValue(block, state.temperature, entry.temperature, HISTORY_NO_VALUE);
+  encodeHistoryValue(block, state.humidity, entry.humidity, HISTORY_NO_HUMIDITY);
+  
+  if (!steady) {
+    if ((uint16_t)(rainFlag | level) == state.rain) {
+      writeHistoryBits(block, 0b0, 1);
+    } else if (rainFlag == (state.rain & HISTORY_RAIN_FLAG) && abs(level - previousLevel) == 1) {
+      writeHistoryBits(block, 0b10, 2);
+      writeHistoryBits(block, level < previousLevel ? 1 : 0, 1);
+    } else {
+      writeHistoryBits(block, 0b11, 2);
+      writeHistoryBits(block, rainFlag ? 1 : 0, 1);
+      writeHistoryBits(block, level, 8);
+    }
+  }
+  
+  state.epochDelta = delta;
+  state.epoch = entry.epoch;
+  state.rain = (uint16_t)(rainFlag | level);
+}
+
+inline void decodeHistoryRecord(const HistoryBlock &block, uint16_t &bitPos, HistoryCodecState &state, HistoryRecord &entry) {
+  bool steady = readHistoryBits(block, bitPos, 1) == 0;
+  if (steady || readHistoryBits(block, bitPos, 1) == 0) {
+    entry.epoch = state.epoch + state.epochDelta;
+  } else if (readHistoryBits(block, bitPos, 1) == 0) {
+    entry.epoch = state.epoch + state.epochDelta + zigzagDecode(readHistoryBits(block, bitPos, 7));
+  } else if (readHistoryBits(block, bitPos, 1) == 0) {
+    entry.epoch = state.epoch + state.epochDelta + zigzagDecode(readHistoryBits(block, bitPos, 9));
+  } else if (readHistoryBits(block, bitPos, 1) == 0) {
+    entry.epoch = state.epoch + state.epochDelta + zigzagDecode(readHistoryBits(block, bitPos, 12));
+  } else {
+    entry.epoch = readHistoryBits(block, bitPos, 32);
+  }
+  
+  entry.temperature = decodeHistoryValue<int16_t>(block, bitPos, state.temperature, HISTORY_NO_VALUE);
+  entry.humidity = decodeHistoryValue<uint16_t>(block, bitPos, state.humidity, HISTORY_NO_HUMIDITY);
+  
+  if (steady || readHistoryBits(block, bitPos, 1) == 0) {
+    entry.rain = state.rain;
+  } else if (readHistoryBits(block, bitPos, 1) == 0) {
+    entry.rain = state.rain + (readHistoryBits(block, bitPos, 1) ? -1 : 1);
+  } else {
+    uint16_t rainFlag = readHistoryBits(block, bitPos, 1) ? HISTORY_RAIN_FLAG : 0;
+    entry.rain = rainFlag | readHistoryBits(block, bitPos, 8);
+  }
+  
+  state.epochDelta = (int64_t)entry.epoch - state.epoch;
+  state.epoch = entry.epoch;
+  state.rain = entry.rain;
+}
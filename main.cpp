@@ -1,26 +1,110 @@
 #include <WiFi.h>
 #include <WebServer.h>
-#include <DHT.h>
 #include <time.h>
 #include <Preferences.h>
 #include <HTTPUpdateServer.h>
 #include <ArduinoOTA.h>
 #include <ArduinoJson.h>
 #include <algorithm>
+#include <atomic>
 #include <WiFiClientSecure.h>
 #include <UniversalTelegramBot.h>
+#include <WebSocketsServer.h>
+#include <esp_partition.h>
+#include <esp_rom_crc.h>
+#include <lwip/sockets.h>
+#include "web_assets.h"
+#include "filters.h"
+#include "sensor_drivers.h"
+#include "rain_detector.h"
+#include "history_codec.h"
+#include "swinging_door.h"
 
 // Константы
 #define DHTPIN 5
 #define DHTTYPE DHT11
 #define RAIN_SENSOR_PIN A0
-#define HISTORY_SAVE_INTERVAL 5 * 60 * 1000 // 5 минут
-#define WEB_UPDATE_INTERVAL 5000
-#define HISTORY_SIZE 50
+#define HISTORY_SAVE_INTERVAL 5 * 60 * 1000 // 5 минут - запись по таймеру, если показания не менялись
+#define HISTORY_MIN_INTERVAL 60 * 1000      // записи по изменению показаний - не чаще
+#define HISTORY_DOOR_TEMPERATURE 0.3f       // °C, коридор swinging door для записи по изменению
+#define HISTORY_DOOR_HUMIDITY 2.0f          // %
+#define HISTORY_SIZE 50              // записей в /history-data по умолчанию и в кеше JSON
+#define HISTORY_BLOCK_COUNT 8        // блоков в памяти; самый старый вытесняется целиком
 #define MAX_SSID_LENGTH 32
 #define MAX_PASSWORD_LENGTH 64
 #define CSRF_TOKEN_LENGTH 32
-#define TELEGRAM_CHECK_INTERVAL 1000
+#define TELEGRAM_LONG_POLL 10       // с, сервер держит getUpdates, пока нет новых сообщений
+#define TELEGRAM_REPLY_WAIT 2000    // мс, задача Telegram ждет ответы loop() на команды
+#define TELEGRAM_SEND_WAIT 5000     // мс, запас на ответ сервера и отправку одного сообщения
+// Ожидание отправки очереди перед перезагрузкой: уже начатый опрос не прерывается
+#define TELEGRAM_FLUSH_TIMEOUT (TELEGRAM_LONG_POLL * 1000 + TELEGRAM_SEND_WAIT)
+#define TELEGRAM_QUEUE_SIZE 8       // команд и исходящих сообщений в очередях
+#define TELEGRAM_TASK_CORE 1
+#define TELEGRAM_TASK_STACK 8192
+#define MAX_EVENT_CLIENTS 4
+#define EVENT_BUFFER_SIZE (384 + 128 * SENSOR_CHANNELS)
+#define SENSOR_JSON_SIZE (384 + 128 * SENSOR_CHANNELS) // документ /sensor-data и события sensor
+#define SENSOR_SAMPLE_INTERVAL_MIN 2000  // период измерений при меняющихся показаниях (DHT22 - не чаще 2 с)
+#define SENSOR_SAMPLE_INTERVAL_MAX 20000 // предел удвоения периода при стабильных показаниях
+#define SENSOR_ACTIVITY_TEMPERATURE 0.3f // °C между измерениями - показания меняются
+#define SENSOR_ACTIVITY_HUMIDITY 2.0f    // % между измерениями
+#define RAIN_ACTIVITY_DELTA 40           // отсчетов АЦП rainValue - начало или конец дождя
+#define SENSOR_MEDIAN_WINDOW 3      // медиана по последним измерениям датчика климата
+#define SENSOR_TASK_CORE 0          // loop() работает на ядре 1
+#define SENSOR_TASK_STACK 4096
+#define SENSOR_MAX_AGE (2 * SENSOR_SAMPLE_INTERVAL_MAX + 5000) // мс, более старый снимок устарел (задача опроса встала)
+#define RAIN_ADC_SAMPLE_RATE 20000  // Гц, непрерывное чтение АЦП через DMA
+#define RAIN_ADC_CONVERSIONS 64     // отсчетов в кадре DMA, драйвер отдает их среднее
+#define RAIN_DECIMATION_MS 100      // кадры усредняются в одно значение за этот период
+#define RAIN_FALLBACK_OVERSAMPLE 16 // отсчетов analogRead() на значение без DMA
+#define RAIN_CALIBRATION_SAMPLES 10 // окно статистики для калибровки (1 с)
+#define RAIN_HAMPEL_WINDOW 7        // окно отбраковки выбросов датчика дождя
+#define RAIN_HAMPEL_MIN_DEVIATION 8 // отклонение в отсчетах АЦП, которое выбросом не считается
+#define RAIN_EMA_ALPHA 0.3f         // сглаживание значения rainValue
+#define RAIN_ON_DELTA 100           // порог включения над уровнем сухого датчика (по умолчанию)
+#define RAIN_MIN_ON_DELTA 10        // меньший порог из настроек не принимается
+#define RAIN_OFF_PERCENT 60         // порог выключения, % от порога включения
+#define RAIN_ON_DWELL_MS 10000      // сигнал выше порога столько мс - начался дождь
+#define RAIN_OFF_DWELL_MS 120000    // ниже порога выключения столько мс - дождь кончился
+#define RAIN_DRIFT_ALPHA 0.0002f    // слежение за дрейфом сухого датчика (~8 мин при шаге 100 мс)
+#define RAIN_INTENSITY_ALPHA 0.02f  // сглаживание превышения для интенсивности (~5 с)
+#define LOOP_STATS_WINDOW 10000     // окно измерения длительности loop()
+#define EVENT_KEEPALIVE_INTERVAL 15000
+#define TELEMETRY_WS_PORT 81
+#define TELEMETRY_FRAME_VERSION 1
+#define HISTORY_RECORD_JSON_SIZE (112 + 24 * SENSOR_CHANNELS)
+#define HISTORY_QUERY_MAX_LIMIT 500
+#define CHART_BUCKET_CAPACITY 64     // кандидатов LTTB в корзине /chart-data
+#define HISTORY_LOG_PARTITION "spiffs" // раздел данных под журнал истории (по метке)
+#define HISTORY_LOG_MAGIC 0x32474C4D   // "MLG2": сжатые блоки
+#define HISTORY_LOG_JOURNAL_SECTORS 2  // последние сектора раздела - записи открытого блока
+#define ROLLUP_HOURLY_SIZE 168        // 7 суток по часу
+#define ROLLUP_DAILY_SIZE 90          // 90 суток по дню
+#define ROLLUP_MAX_POINTS 200         // больше точек в ответе /history-range не отдается
+// Записей в окне span секунд: с запасом на записи по изменению показаний. Если их
+// больше, окно сокращается до последних STATS_WINDOW_CAPACITY(span) записей.
+#define STATS_WINDOW_CAPACITY(span) (2 * (span) / ((HISTORY_SAVE_INTERVAL) / 1000) + 1)
+#define STATS_CAPACITY STATS_WINDOW_CAPACITY(24 * 3600)  // самое длинное окно
+#define STATS_WINDOW_COUNT 3
+#define MIN_VALID_EPOCH 1600000000 // время до этой метки считается несинхронизированным
+
+// Датчики из sensor_drivers.h выбираются при сборке: датчики климата - по одному
+// на канал, в порядке SENSOR_CHANNEL_NAMES (канал 0 - основной), и датчик дождя, например
+// -DCLIMATE_SENSORS="Bme280Driver<0x76>, Sht3xDriver<0x44>" -DSENSOR_CHANNEL_NAMES='"Улица", "Дом"'
+#ifndef CLIMATE_SENSORS
+#define CLIMATE_SENSORS DhtDriver<DHTPIN, DHTTYPE>
+#endif
+#ifndef SENSOR_CHANNEL_NAMES
+#define SENSOR_CHANNEL_NAMES "Улица"
+#endif
+#ifndef RAIN_SENSOR
+#define RAIN_SENSOR AnalogRainDriver<RAIN_SENSOR_PIN, RAIN_ADC_CONVERSIONS, RAIN_ADC_SAMPLE_RATE, RAIN_FALLBACK_OVERSAMPLE>
+#endif
+
+// Экземпляры датчиков принадлежат задаче опроса
+typedef ClimateSensorSet<CLIMATE_SENSORS> ClimateSensors;
+typedef RAIN_SENSOR RainSensor;
+#define SENSOR_CHANNELS ClimateSensors::count
 
 // Telegram настройки (ЗАМЕНИТЕ НА СВОИ!)
 #define TELEGRAM_BOT_TOKEN ""
@@ -37,49 +121,291 @@ struct OTASettings {
   char password[MAX_PASSWORD_LENGTH];
 };
 
+// Снимок показаний. Измерения, порог и состояние дождя пишет задача опроса
+// датчиков (RainDetector), остальной код снимок только читает.
+// Показания климата - по столбцу на величину, элемент i - канал i.
 struct SensorData {
-  float temperature;
-  float humidity;
+  float temperature[SENSOR_CHANNELS];
+  float humidity[SENSOR_CHANNELS];
+  float pressure[SENSOR_CHANNELS];   // гПа, NAN - датчик канала не измеряет давление
   bool isRaining;
-  int rainValue;
-  int rainThreshold;
-  String lastUpdate;
+  uint8_t rainIntensity; // RainIntensity, RAIN_NONE без дождя
+  int rainValue;         // последнее усредненное значение (RAIN_DECIMATION_MS)
+  int rainAverage;       // среднее за окно калибровки
+  float rainDeviation;   // стандартное отклонение за окно калибровки
+  int rainBaseline;      // уровень сухого датчика с учетом дрейфа
+  int rainThreshold;     // текущий порог включения (уровень + rainOnDelta)
+  uint32_t epoch;        // время измерения, 0 - время не синхронизировано
+  uint32_t sample;       // номер измерения, 0 - измерений еще не было
+  uint32_t sampledAt;    // millis() в момент измерения
+  uint32_t sampleInterval; // мс до следующего измерения (темп опроса)
 };
 
-struct HistoryRecord {
-  float temperature;
-  float humidity;
-  bool isRaining;
-  String timestamp;
-};
+// Журнал истории во флеше: раздел делится на сегменты по одному сектору.
+// Сегмент - заголовок и закрытые сжатые блоки с CRC32, как они лежат в памяти
+// (раскладка в history_codec.h). Сегменты заполняются по кругу, поэтому
+// стирания распределяются равномерно. Записи открытого блока, пока он не
+// закрыт, дублируются по одной в журнал записей - последние
+// HISTORY_LOG_JOURNAL_SECTORS секторов раздела; при закрытии блока он стирается.
+#define HISTORY_LOG_JOURNAL_SLOTS (HISTORY_LOG_JOURNAL_SECTORS * HISTORY_LOG_SECTOR_SIZE / sizeof(HistoryLogEntry))
+static_assert(HISTORY_LOG_JOURNAL_SLOTS >= HISTORY_BLOCK_MAX_RECORDS, "journal must hold a whole open block");
 
 struct {
-  HistoryRecord records[HISTORY_SIZE];
-  int count = 0;
-  int index = 0;
+  const esp_partition_t *partition = nullptr;
+  uint32_t segmentCount = 0;   // сегменты под блоки, без журнала записей
+  uint32_t journalOffset = 0;  // начало журнала записей в разделе
+  uint32_t usedSegments = 0;
+  uint32_t oldestSegment = 0;
+  uint32_t headSegment = 0;
+  uint32_t headSegmentSeq = 0;
+  uint32_t nextBlock = 0;      // первая свободная позиция блока в головном сегменте
+  uint32_t firstSeq = 0;       // первая запись самого старого блока
+  uint32_t endSeq = 1;         // номер записи после последнего закрытого блока
+  uint32_t journalSeq = 0;     // номер записи в позиции 0 журнала, 0 - журнал пуст
+} historyLog;
+
+struct {
+  HistoryBlock blocks[HISTORY_BLOCK_COUNT];
+  int blockCount = 0;
+  int head = 0;                // блок, в который идет запись
+  bool headOpen = false;       // головной блок закодирован здесь, а не загружен из флеша
+  uint32_t count = 0;          // записей во всех блоках
+  HistoryCodecState state;     // состояние кодировщика головного блока
 } sensorHistory;
 
+// Показания всех каналов климата для последних HISTORY_SIZE записей истории.
+// Хранятся по столбцам: время и значения каждого канала лежат подряд, поэтому
+// сводки и сериализация проходят по непрерывным массивам. Сжатая история,
+// журнал и сводки ведутся по каналу 0; в записях старше окна и восстановленных
+// после перезагрузки остальных каналов нет.
+struct {
+  uint32_t headSeq = 0;     // номер последней записи, 0 - записей нет
+  uint16_t count = 0;       // заняты позиции [0, count)
+  uint16_t next = 0;        // позиция следующей записи в кольце
+  uint32_t epoch[HISTORY_SIZE];
+  int16_t temperature[SENSOR_CHANNELS][HISTORY_SIZE];  // как в HistoryRecord
+  uint16_t humidity[SENSOR_CHANNELS][HISTORY_SIZE];
+} channelHistory;
+
+// Кандидаты LTTB для /chart-data: текущая и следующая корзины по очереди
+struct {
+  HistoryRecord records[2][CHART_BUCKET_CAPACITY];
+  uint32_t seqs[2][CHART_BUCKET_CAPACITY];
+  uint16_t count[2];
+} chartBuckets;
+
+// Потоковое чтение истории по порядку номеров: закрытые блоки старше блоков
+// в памяти читаются из журнала во флеше в logBlock, дальше блоки в памяти
+// декодируются последовательно
+struct HistoryCursor {
+  uint32_t seq;                // номер следующей записи
+  int block;                   // блок в памяти; -1, пока позиция в блоках не найдена
+  bool inLog;                  // декодируется logBlock
+  uint16_t bitPos;
+  uint16_t indexInBlock;
+  HistoryCodecState state;
+  HistoryBlock logBlock;
+};
+
+// Агрегат истории за час или сутки (28 байт). Единицы те же, что в HistoryRecord.
+struct __attribute__((packed)) RollupBucket {
+  uint32_t start;          // начало интервала (Unix-время, граница местных суток/часа)
+  int16_t tempMin;
+  int16_t tempMax;
+  int32_t tempSum;
+  uint16_t tempCount;
+  uint16_t humMin;
+  uint16_t humMax;
+  uint32_t humSum;
+  uint16_t humCount;
+  uint32_t rainSeconds;    // время с дождем по записям (historyRecordSpan)
+};
+static_assert(sizeof(RollupBucket) == 28, "RollupBucket layout changed");
+
+// Кольцевой буфер агрегатов одного разрешения
+struct RollupTier {
+  const char *name;
+  uint32_t period;         // длина интервала, секунды
+  RollupBucket *buckets;
+  uint16_t capacity;
+  uint16_t count;
+  uint16_t index;          // позиция следующего интервала
+};
+
+// Скользящая статистика за 1, 6 и 24 часа. Последние записи хранятся в общем
+// кольцевом буфере; у каждого окна свои монотонные очереди позиций для min/max
+// и суммы для среднего и линейной регрессии (наклон - скорость изменения).
+// Время в суммах - секунды от statsBaseEpoch, суммы целые и не накапливают ошибку.
+struct __attribute__((packed)) StatsSample {
+  uint32_t epoch;
+  int16_t temperature;   // как в HistoryRecord
+  uint16_t humidity;
+};
+
+struct MonotonicQueue {
+  uint16_t *items;           // позиции в statsSamples, кольцо на capacity окна
+  uint16_t head = 0;
+  uint16_t count = 0;
+};
+
+struct StatsSeries {
+  MonotonicQueue minQueue;   // значения по возрастанию: спереди минимум
+  MonotonicQueue maxQueue;   // значения по убыванию: спереди максимум
+  uint16_t count = 0;
+  int64_t sumX = 0;
+  int64_t sumT = 0;
+  int64_t sumTX = 0;
+  int64_t sumTT = 0;
+};
+
+// Итог по одному ряду окна в единицах измерения
+struct StatsSummary {
+  uint16_t count;
+  float min;
+  float max;
+  float avg;
+  float trend;           // изменение за час, NAN - недостаточно данных
+};
+
+struct StatsWindow {
+  const char *name;
+  uint32_t span;          // секунды
+  uint16_t capacity;      // записей в окне и позиций в каждой очереди
+  uint32_t tail = 0;      // номер самой старой записи окна
+  StatsSeries temperature;
+  StatsSeries humidity;
+};
+
+// Последний снимок показаний под seqlock: задача опроса - единственный писатель,
+// читатели копируют данные и повторяют чтение, если номер изменился или нечетный
+struct {
+  std::atomic<uint32_t> seq{0};
+  SensorData data;
+} sensorSnapshot;
+
+// Запись истории по изменению показаний канала 0
+struct {
+  SwingingDoor temperature = {HISTORY_DOOR_TEMPERATURE, NAN, 0, INFINITY, -INFINITY};
+  SwingingDoor humidity = {HISTORY_DOOR_HUMIDITY, NAN, 0, INFINITY, -INFINITY};
+  uint32_t originSample = 0;     // измерение, от которого строятся коридоры
+  bool raining = false;          // признак дождя в последней записи
+  SensorData previous = {};      // последнее обработанное измерение
+  SensorData lastFitting = {};   // последнее измерение, уложившееся в коридоры
+} historyRecorder;
+
+// Длительность прохода loop() в микросекундах: текущее и прошлое окно, пик с запуска
+struct {
+  unsigned long windowStart = 0;
+  uint32_t count = 0;
+  uint64_t totalUs = 0;
+  uint32_t maxUs = 0;
+  uint32_t lastAvgUs = 0;
+  uint32_t lastMaxUs = 0;
+  uint32_t peakUs = 0;
+  uint32_t sensorStepMaxUs = 0;  // самое долгое измерение в задаче опроса (на другом ядре)
+} loopStats;
+
+// Бинарный кадр телеметрии для WebSocket (little-endian, без выравнивания)
+struct __attribute__((packed)) TelemetryFrame {
+  uint8_t version;        // TELEMETRY_FRAME_VERSION
+  uint8_t flags;          // бит 0: идет дождь, бит 1: показания устарели (старше SENSOR_MAX_AGE),
+                          // биты 2-3: интенсивность дождя (RainIntensity)
+  uint16_t rainValue;
+  uint16_t rainThreshold;
+  float temperature;      // °C
+  float humidity;         // %
+  uint32_t epoch;         // Unix-время измерения, 0 если время не синхронизировано
+};
+static_assert(sizeof(TelemetryFrame) == 18, "TelemetryFrame layout changed");
+
+// Команды из Telegram для loop(): данные станции читаются и меняются только там
+enum TelegramCommand : uint8_t {
+  TELEGRAM_STATUS,
+  TELEGRAM_HISTORY,
+  TELEGRAM_STATS,
+  TELEGRAM_CALIBRATE,
+  TELEGRAM_REBOOT
+};
+
+// Исходящее сообщение в TELEGRAM_CHAT_ID. Текст в куче, его освобождает задача Telegram.
+struct TelegramMessage {
+  String *text;
+  char parseMode[12];
+};
+
+// Подписчик /events с ограниченным буфером неотправленных данных
+struct EventClient {
+  WiFiClient client;
+  char pending[EVENT_BUFFER_SIZE];
+  size_t pendingLength = 0;
+  bool active = false;
+};
+
+// Подписи каналов климата для ответов и Telegram
+const char *const channelNames[] = {SENSOR_CHANNEL_NAMES};
+static_assert(sizeof(channelNames) / sizeof(channelNames[0]) == SENSOR_CHANNELS, "SENSOR_CHANNEL_NAMES must name every climate sensor");
+
 // Глобальные объекты
 WiFiSettings wifiSettings;
 OTASettings otaSettings;
-SensorData sensorData;
 WebServer server(80);
-DHT dht(DHTPIN, DHTTYPE);
 Preferences preferences;
 HTTPUpdateServer httpUpdater;
 WiFiClientSecure secured_client;
 UniversalTelegramBot bot(TELEGRAM_BOT_TOKEN, secured_client);
+EventClient eventClients[MAX_EVENT_CLIENTS];
+WebSocketsServer telemetrySocket(TELEMETRY_WS_PORT);
 
 // Переменные состояния
 unsigned long lastHistorySave = 0;
-unsigned long lastWebUpdate = 0;
-unsigned long lastTelegramCheck = 0;
+unsigned long lastEventKeepAlive = 0;
 int timeZoneOffset = 3;
+volatile int rainOnDelta = RAIN_ON_DELTA;       // порог включения над уровнем сухого датчика
+std::atomic<int> rainBaselineRequest(-1);       // новый уровень сухого датчика для задачи опроса, -1 - нет
+TaskHandle_t sensorTaskHandle = nullptr;
+TaskHandle_t telegramTaskHandle = nullptr;
+QueueHandle_t telegramCommands = nullptr;       // TelegramCommand: задача Telegram -> loop()
+QueueHandle_t telegramOutbox = nullptr;         // TelegramMessage: loop() -> задача Telegram
+std::atomic<uint32_t> telegramPending(0);       // сообщений в очереди и в отправке
+std::atomic<bool> networkChanged(false);        // адрес получен или потерян (из задачи событий WiFi)
 bool isAPMode = false;
 bool isWiFiConfigured = false;
 bool shouldReboot = false;
 String csrfToken;
 
+// Версии данных для ETag: увеличиваются при каждом изменении ответа
+// /sensor-data и /history-data. bootId отличает версии разных запусков.
+// Записи истории нумеруются подряд, номер самой старой вычисляется по количеству.
+uint32_t bootId = 0;
+uint32_t sensorDataVersion = 0;
+uint32_t historyHeadSeq = 0; // номер последней записи истории, он же ее версия
+uint32_t historyTimeVersion = 0; // растет при смене часового пояса: время в записях выводится заново
+
+// Готовые JSON-ответы: пересобираются только при изменении данных
+String sensorJsonCache;
+uint32_t sensorJsonCacheVersion = 0;
+String historyJsonCache;
+
+// Почасовые и суточные агрегаты истории
+RollupBucket hourlyBuckets[ROLLUP_HOURLY_SIZE];
+RollupBucket dailyBuckets[ROLLUP_DAILY_SIZE];
+RollupTier hourlyRollup = {"hour", 3600, hourlyBuckets, ROLLUP_HOURLY_SIZE, 0, 0};
+RollupTier dailyRollup = {"day", 86400, dailyBuckets, ROLLUP_DAILY_SIZE, 0, 0};
+
+// Скользящая статистика
+StatsSample statsSamples[STATS_CAPACITY];
+uint32_t statsSampleCount = 0;   // всего добавлено записей, позиция - номер % STATS_CAPACITY
+uint32_t statsBaseEpoch = 0;
+// Очереди окон по размеру окна: минимум и максимум температуры, затем влажности
+uint16_t statsQueues1h[4][STATS_WINDOW_CAPACITY(3600)];
+uint16_t statsQueues6h[4][STATS_WINDOW_CAPACITY(6 * 3600)];
+uint16_t statsQueues24h[4][STATS_WINDOW_CAPACITY(24 * 3600)];
+StatsWindow statsWindows[STATS_WINDOW_COUNT] = {
+  {"1h", 3600, STATS_WINDOW_CAPACITY(3600), 0, {{statsQueues1h[0]}, {statsQueues1h[1]}}, {{statsQueues1h[2]}, {statsQueues1h[3]}}},
+  {"6h", 6 * 3600, STATS_WINDOW_CAPACITY(6 * 3600), 0, {{statsQueues6h[0]}, {statsQueues6h[1]}}, {{statsQueues6h[2]}, {statsQueues6h[3]}}},
+  {"24h", 24 * 3600, STATS_WINDOW_CAPACITY(24 * 3600), 0, {{statsQueues24h[0]}, {statsQueues24h[1]}}, {{statsQueues24h[2]}, {statsQueues24h[3]}}}
+};
+
 // Прототипы функций
 void initPreferences();
 void saveWiFiSettings();
@@ -87,12 +413,45 @@ void saveOTASettings();
 void connectWiFi();
 void activateAPMode();
 void configLocalTime();
+void applyTimeZone();
 void checkWiFi();
-void readSensors();
-void calibrateRainSensor();
-void saveHistory();
-String generateHTML();
-void handleRoot();
+void onWiFiEvent(arduino_event_id_t event, arduino_event_info_t info);
+void sensorTask(void *parameter);
+void writeSensorSnapshot(const SensorData &data);
+SensorData readSensorSnapshot();
+bool readFreshSensorSnapshot(SensorData &data, uint32_t maxAge);
+uint32_t sensorDataAge(const SensorData &data);
+void formatSensorAge(const SensorData &data, char *buf, size_t size);
+void pollSensorSnapshot();
+bool sameReading(float a, float b);
+void publishSensorEvent(int slot = -1);
+void formatEpochTime(uint32_t epoch, char *buffer, size_t size);
+void recordLoopTime(uint32_t elapsedUs);
+void handleLoopStats();
+bool calibrateRainSensor(int *threshold = nullptr);
+const char *rainIntensityName(uint8_t intensity);
+void saveHistory(const SensorData &data, time_t epoch);
+bool updateHistoryRecorder();
+void startHistoryDoors(const SensorData &data);
+uint32_t historyRecordSpan(uint32_t previousEpoch, uint32_t epoch);
+HistoryRecord packHistoryRecord(const SensorData &data, time_t epoch);
+int16_t packTemperature(float temperature);
+uint16_t packHumidity(float humidity);
+float unpackTemperature(int16_t temperature);
+float unpackHumidity(uint16_t humidity);
+float historyTemperature(const HistoryRecord &entry);
+float historyHumidity(const HistoryRecord &entry);
+int historyRainValue(const HistoryRecord &entry);
+bool historyIsRaining(const HistoryRecord &entry);
+void formatHistoryTime(const HistoryRecord &entry, char *buffer, size_t size);
+void channelHistoryAppend(uint32_t seq, const SensorData &data, uint32_t epoch);
+int channelHistoryIndex(uint32_t seq);
+uint32_t channelHistorySpan();
+StatsSummary summarizeChannelTemperature(size_t channel);
+StatsSummary summarizeChannelHumidity(size_t channel);
+void handleStaticAsset(const WebAsset &asset);
+bool handleNotModified(const String &etag, const char *cacheControl);
+String makeETag(char kind, uint32_t version, uint32_t revision = 0);
 void handleSensorData();
 void handleHistoryData();
 void handleSetTZ();
@@ -100,11 +459,67 @@ void handleCalibrate();
 void handleSaveWiFi();
 void handleSaveOTA();
 void handleReset();
+void handleEvents();
+int activeEventClients();
+void publishEvent(const char *event, const char *data, int slot = -1);
+void pumpEventClients();
+void fillSensorJson(DynamicJsonDocument &doc);
+void setupTelemetrySocket();
+void fillTelemetryFrame(TelemetryFrame &frame);
+void fillHistoryJson(JsonObject record, const HistoryRecord &entry, uint32_t seq);
+uint32_t historyOldestSeq();
+uint32_t historyWindowSeq();
+uint32_t historyFirstSeq();
+const HistoryBlock *historyStoreAppend(uint32_t seq, const HistoryRecord &entry);
+void historyStoreLoad(const HistoryBlock &block);
+void historyCursorSeek(HistoryCursor &cursor, uint32_t seq);
+void historyCursorStart(HistoryCursor &cursor, const HistoryBlock &block);
+bool historyCursorNext(HistoryCursor &cursor, HistoryRecord &entry, uint32_t endSeq = UINT32_MAX);
+void initHistoryLog();
+bool readHistoryLogHeader(uint32_t segment, HistoryLogHeader &header);
+bool historyLogSlotUsed(uint32_t segment, uint32_t slot);
+uint32_t historyLogBlockCount();
+uint32_t historyLogBlockOffset(uint32_t index);
+bool historyLogReadBlock(uint32_t index, HistoryBlock &block);
+uint32_t historyLogFindBlock(uint32_t seq);
+bool historyLogRead(uint32_t seq, HistoryRecord &entry);
+void historyLogAppend(uint32_t seq, const HistoryRecord &entry, const HistoryBlock *sealed);
+void historyLogWriteBlock(const HistoryBlock &block);
+void restoreHistoryFromLog();
+void addToRollup(RollupTier &tier, const HistoryRecord &entry, uint32_t span);
+void addToRollups(const HistoryRecord &entry);
+void replayRollups();
+const RollupBucket &rollupBucket(const RollupTier &tier, int i);
+size_t serializeRollupBucket(const RollupBucket &bucket, char *buffer, size_t size);
+void handleHistoryRange();
+void resetRollupBucket(RollupBucket &bucket, uint32_t start);
+void addToRollupBucket(RollupBucket &bucket, const HistoryRecord &entry, uint32_t span);
+uint32_t findHistorySeqByTime(uint32_t epoch);
+uint32_t historyLogEpochAt(uint32_t index);
+void handleHistoryQuery();
+void handleChartData();
+void addToStats(const HistoryRecord &entry);
+void replayStats();
+void statsSeriesAdd(StatsSeries &series, uint16_t capacity, uint16_t pos, int32_t value, int64_t t, bool temperature);
+void statsSeriesRemove(StatsSeries &series, uint16_t capacity, uint16_t pos, int32_t value, int64_t t);
+int32_t statsValue(const StatsSample &sample, bool temperature);
+StatsSummary summarizeStats(const StatsSeries &series, bool temperature);
+void fillStatsJson(JsonObject stats, const StatsSummary &summary);
+void handleStats();
+String formatTelegramStats();
+double triangleArea(const HistoryRecord &a, const HistoryRecord &b, uint32_t cEpoch, float cTemp, float cHum);
+size_t serializeHistoryRecord(const HistoryRecord &entry, uint32_t seq, char *buffer, size_t size);
+void rebuildSensorJsonCache();
+void rebuildHistoryJsonCache();
+void appendHistoryJsonCache(const char *recordJson, bool dropOldest);
 void setupOTA();
 void setupWebServer();
 void generateCsrfToken();
 bool validateCsrf();
-void handleTelegram();
+void telegramTask(void *parameter);
+bool dispatchTelegramMessage(const telegramMessage &message);
+void handleTelegramCommands();
+bool flushTelegramOutbox(uint32_t timeout);
 void sendTelegramNotification(const String &message, const String &parse_mode = "");
 String generateTelegramMenu();
 String generateTelegramKeyboard();
@@ -118,9 +533,20 @@ void setup() {
   // Генерация CSRF-токена
   generateCsrfToken();
   
-  // Настройка пинов
-  pinMode(RAIN_SENSOR_PIN, INPUT);
-  dht.begin();
+  // Идентификатор запуска для ETag
+  bootId = esp_random();
+  
+  // Восстановление истории из журнала во флеше. Время записей в кеше JSON
+  // выводится в местном поясе, поэтому он задается до подключения к сети.
+  applyTimeZone();
+  initHistoryLog();
+  restoreHistoryFromLog();
+  replayRollups();
+  replayStats();
+  rebuildHistoryJsonCache();
+  
+  // Опрос датчиков в отдельной задаче на другом ядре
+  xTaskCreatePinnedToCore(sensorTask, "sensors", SENSOR_TASK_STACK, nullptr, 1, &sensorTaskHandle, SENSOR_TASK_CORE);
   
   // Подключение WiFi
   connectWiFi();
@@ -128,109 +554,218 @@ void setup() {
   // Настройка времени
   if (WiFi.status() == WL_CONNECTED) {
     configLocalTime();
-    secured_client.setInsecure(); // Для простоты отключаем проверку сертификата
   }
   
-  // Калибровка датчика дождя
-  calibrateRainSensor();
+  // Telegram - в своей задаче: она подключается, когда появится WiFi, loop() обменивается с ней очередями
+  secured_client.setInsecure(); // Для простоты отключаем проверку сертификата
+  telegramCommands = xQueueCreate(TELEGRAM_QUEUE_SIZE, sizeof(TelegramCommand));
+  telegramOutbox = xQueueCreate(TELEGRAM_QUEUE_SIZE, sizeof(TelegramMessage));
+  xTaskCreatePinnedToCore(telegramTask, "telegram", TELEGRAM_TASK_STACK, nullptr, 1, &telegramTaskHandle, TELEGRAM_TASK_CORE);
+  
+  // Калибровка датчика дождя: первый снимок появляется, когда заполнится окно статистики
+  for (int waited = 0; !calibrateRainSensor() && waited < 3000; waited += 10) {
+    delay(10);
+  }
   
   // Настройка OTA и веб-сервера
   setupOTA();
   setupWebServer();
+  setupTelemetrySocket();
   
   Serial.println("Система инициализирована!");
   sendTelegramNotification("🚀 *Метеостанция запущена!*\nIP: " + WiFi.localIP().toString() + "\nИспользуйте кнопку *Меню* для управления", "Markdown");
 }
 
 void loop() {
+  uint32_t loopStart = micros();
+  
   ArduinoOTA.handle();
   checkWiFi();
   server.handleClient();
+  pumpEventClients();
+  telemetrySocket.loop();
+  pollSensorSnapshot();
   
-  // Обработка Telegram сообщений
-  if (millis() - lastTelegramCheck > TELEGRAM_CHECK_INTERVAL && WiFi.status() == WL_CONNECTED) {
-    handleTelegram();
-    lastTelegramCheck = millis();
-  }
+  // Команды Telegram приходят из задачи бота
+  handleTelegramCommands();
   
   if (shouldReboot) {
     sendTelegramNotification("🔁 *Метеостанция перезагружается...*", "Markdown");
     Serial.println("Перезагрузка системы...");
+    flushTelegramOutbox(TELEGRAM_FLUSH_TIMEOUT);
     delay(1000);
     ESP.restart();
   }
   
-  // Автоматическое сохранение в историю
-  if (millis() - lastHistorySave > HISTORY_SAVE_INTERVAL) {
-    readSensors();
-    saveHistory();
-    lastHistorySave = millis();
-    
-    // Уведомление о дожде
+  // Запись в историю: по таймеру и по значимому изменению показаний
+  if (updateHistoryRecorder()) {
+    // Уведомление о дожде - только по свежим показаниям
     static bool lastRainStatus = false;
-    if (sensorData.isRaining != lastRainStatus) {
-      if (sensorData.isRaining) {
-        sendTelegramNotification("🌧️ *Внимание! Начался дождь!*\nТемпература: " + String(sensorData.temperature, 1) + "°C\nВлажность: " + String(sensorData.humidity, 1) + "%", "Markdown");
+    SensorData data;
+    if (readFreshSensorSnapshot(data, SENSOR_MAX_AGE) && data.isRaining != lastRainStatus) {
+      if (data.isRaining) {
+        sendTelegramNotification("🌧️ *Внимание! Начался дождь!*\nИнтенсивность: " + String(rainIntensityName(data.rainIntensity)) + "\nТемпература: " + String(data.temperature[0], 1) + "°C\nВлажность: " + String(data.humidity[0], 1) + "%", "Markdown");
       } else {
-        sendTelegramNotification("☀️ *Дождь закончился*\nТемпература: " + String(sensorData.temperature, 1) + "°C\nВлажность: " + String(sensorData.humidity, 1) + "%", "Markdown");
+        sendTelegramNotification("☀️ *Дождь закончился*\nТемпература: " + String(data.temperature[0], 1) + "°C\nВлажность: " + String(data.humidity[0], 1) + "%", "Markdown");
       }
-      lastRainStatus = sensorData.isRaining;
+      lastRainStatus = data.isRaining;
     }
   }
   
+  recordLoopTime(micros() - loopStart);
   delay(10);
 }
 
 // ========== Telegram Functions ==========
-void handleTelegram() {
-  int newMessages = bot.getUpdates(bot.last_message_received + 1);
-
-  for (int i = 0; i < newMessages; i++) {
-    String chat_id = String(bot.messages[i].chat_id);
-    if (chat_id != TELEGRAM_CHAT_ID) {
-      bot.sendMessage(chat_id, "⛔ Доступ запрещен", "");
+// Задача владеет ботом и TLS-соединением: ждет сообщения долгим опросом getUpdates
+// (сервер держит запрос до TELEGRAM_LONG_POLL с), на меню и неизвестные команды
+// отвечает сама, остальные команды передает в loop() через очередь telegramCommands.
+// Ответы и уведомления приходят обратно через telegramOutbox и отправляются между
+// опросами: после команд задача до TELEGRAM_REPLY_WAIT мс ждет ответы на них.
+// Запрос getUpdates, начатый до появления уведомления, прервать нельзя, поэтому
+// уведомление без команды может задержаться до TELEGRAM_LONG_POLL с; если оно
+// пришло, пока задача отправляла очередь, следующий опрос короткий.
+void telegramTask(void *parameter) {
+  int awaitingReplies = 0;
+  
+  for (;;) {
+    TickType_t deadline = xTaskGetTickCount() + pdMS_TO_TICKS(TELEGRAM_REPLY_WAIT);
+    TelegramMessage message;
+    for (;;) {
+      TickType_t now = xTaskGetTickCount();
+      TickType_t wait = awaitingReplies > 0 && (int32_t)(deadline - now) > 0 ? deadline - now : 0;
+      if (xQueueReceive(telegramOutbox, &message, wait) != pdTRUE) break;
+      if (WiFi.status() == WL_CONNECTED) {
+        bot.sendMessage(TELEGRAM_CHAT_ID, *message.text, message.parseMode);
+      }
+      delete message.text;
+      telegramPending--;
+      if (awaitingReplies > 0) awaitingReplies--;
+    }
+    awaitingReplies = 0;
+    
+    if (WiFi.status() != WL_CONNECTED) {
+      vTaskDelay(pdMS_TO_TICKS(1000));
       continue;
     }
+    bot.longPoll = telegramPending > 0 ? 0 : TELEGRAM_LONG_POLL;
+    int newMessages = bot.getUpdates(bot.last_message_received + 1);
+    for (int i = 0; i < newMessages; i++) {
+      if (dispatchTelegramMessage(bot.messages[i])) awaitingReplies++;
+    }
+  }
+}
 
-    String text = bot.messages[i].text;
-    Serial.println("Telegram: " + text);
+// Разбор сообщения в задаче Telegram. true - команда передана в loop() и ждет ответа
+bool dispatchTelegramMessage(const telegramMessage &message) {
+  String chat_id = String(message.chat_id);
+  if (chat_id != TELEGRAM_CHAT_ID) {
+    bot.sendMessage(chat_id, "⛔ Доступ запрещен", "");
+    return false;
+  }
+  
+  const String &text = message.text;
+  Serial.println("Telegram: " + text);
+  
+  TelegramCommand command;
+  if (text == "/start" || text == "/help" || text == "Меню") {
+    bot.sendMessageWithReplyKeyboard(chat_id, generateTelegramMenu(), "Markdown", generateTelegramKeyboard(), true);
+    return false;
+  }
+  else if (text == "📊 Текущие показания" || text == "/status") {
+    command = TELEGRAM_STATUS;
+  }
+  else if (text == "⏳ История данных" || text == "/history") {
+    command = TELEGRAM_HISTORY;
+  }
+  else if (text == "📈 Статистика" || text == "/stats") {
+    command = TELEGRAM_STATS;
+  }
+  else if (text == "🔧 Калибровка" || text == "/calibrate") {
+    command = TELEGRAM_CALIBRATE;
+  }
+  else if (text == "🔄 Перезагрузка" || text == "/reboot") {
+    command = TELEGRAM_REBOOT;
+  }
+  else {
+    bot.sendMessage(chat_id, "❌ Неизвестная команда. Нажмите кнопку *Меню*", "Markdown");
+    return false;
+  }
+  
+  if (xQueueSend(telegramCommands, &command, 0) != pdTRUE) {
+    bot.sendMessage(chat_id, "⚠️ *Станция занята*, повторите команду позже", "Markdown");
+    return false;
+  }
+  return true;
+}
 
-    if (text == "/start" || text == "/help" || text == "Меню") {
-      bot.sendMessageWithReplyKeyboard(chat_id, generateTelegramMenu(), "Markdown", generateTelegramKeyboard(), true);
-    }
-    else if (text == "📊 Текущие показания" || text == "/status") {
-      readSensors();
-      String message = "📊 *Текущие показания*\n\n";
-      message += "🌡️ Температура: *" + String(sensorData.temperature, 1) + " °C*\n";
-      message += "💧 Влажность: *" + String(sensorData.humidity, 1) + " %*\n";
-      message += sensorData.isRaining ? "🌧️ Состояние: *Идет дождь*\n" : "☀️ Состояние: *Без осадков*\n";
-      message += "📶 Сигнал WiFi: " + String(WiFi.RSSI()) + " dBm\n";
-      message += "🕒 Последнее обновление: " + sensorData.lastUpdate;
-      bot.sendMessage(chat_id, message, "Markdown");
-    }
-    else if (text == "⏳ История данных" || text == "/history") {
-      String message = "⏳ *Последние 5 измерений*\n\n";
-      int count = min(5, sensorHistory.count);
-      
-      for (int i = 0; i < count; i++) {
-        int idx = (sensorHistory.index - count + i + HISTORY_SIZE) % HISTORY_SIZE;
-        message += "🕒 " + sensorHistory.records[idx].timestamp + "\n";
-        message += "🌡️ " + String(sensorHistory.records[idx].temperature, 1) + " °C  ";
-        message += "💧 " + String(sensorHistory.records[idx].humidity, 1) + " %\n";
-        message += sensorHistory.records[idx].isRaining ? "🌧️ *Дождь*\n\n" : "☀️ *Сухо*\n\n";
+// Вызывается из loop(): команды выполняются рядом с остальными данными станции,
+// ответ уходит в TELEGRAM_CHAT_ID через очередь отправки
+void handleTelegramCommands() {
+  TelegramCommand command;
+  while (xQueueReceive(telegramCommands, &command, 0) == pdTRUE) {
+    switch (command) {
+      case TELEGRAM_STATUS: {
+        SensorData data;
+        bool fresh = readFreshSensorSnapshot(data, SENSOR_MAX_AGE);
+        char timeStr[20], ageStr[24];
+        formatEpochTime(data.epoch, timeStr, sizeof(timeStr));
+        formatSensorAge(data, ageStr, sizeof(ageStr));
+        String message = "📊 *Текущие показания*\n\n";
+        for (size_t i = 0; i < SENSOR_CHANNELS; i++) {
+          if (SENSOR_CHANNELS > 1) message += "📍 *" + String(channelNames[i]) + "*\n";
+          message += "🌡️ Температура: *" + String(data.temperature[i], 1) + " °C*\n";
+          message += "💧 Влажность: *" + String(data.humidity[i], 1) + " %*\n";
+          if (ClimateSensors::measures(i) & SENSOR_MEASURE_PRESSURE) {
+            message += "🧭 Давление: *" + String(data.pressure[i], 1) + " гПа*\n";
+          }
+        }
+        message += data.isRaining ? "🌧️ Состояние: *Идет дождь* (" + String(rainIntensityName(data.rainIntensity)) + ")\n" : "☀️ Состояние: *Без осадков*\n";
+        message += "📶 Сигнал WiFi: " + String(WiFi.RSSI()) + " dBm\n";
+        message += "🕒 Последнее обновление: " + String(timeStr) + " (" + String(ageStr) + ")";
+        if (!fresh) message += "\n⚠️ *Показания устарели*";
+        sendTelegramNotification(message, "Markdown");
+        break;
       }
-      bot.sendMessage(chat_id, message, "Markdown");
-    }
-    else if (text == "🔧 Калибровка" || text == "/calibrate") {
-      calibrateRainSensor();
-      bot.sendMessage(chat_id, "🔧 *Датчик дождя откалиброван*\nНовый порог: " + String(sensorData.rainThreshold), "Markdown");
-    }
-    else if (text == "🔄 Перезагрузка" || text == "/reboot") {
-      bot.sendMessage(chat_id, "🔁 *Перезагрузка системы...*", "Markdown");
-      shouldReboot = true;
-    }
-    else {
-      bot.sendMessage(chat_id, "❌ Неизвестная команда. Нажмите кнопку *Меню*", "Markdown");
+      case TELEGRAM_HISTORY: {
+        String message = "⏳ *Последние 5 измерений*\n\n";
+        HistoryCursor cursor;
+        historyCursorSeek(cursor, std::max(historyOldestSeq(), historyHeadSeq > 4 ? historyHeadSeq - 4 : 1));
+        HistoryRecord entry;
+        
+        while (historyCursorNext(cursor, entry)) {
+          char timeStr[20];
+          formatHistoryTime(entry, timeStr, sizeof(timeStr));
+          message += "🕒 " + String(timeStr) + "\n";
+          message += "🌡️ " + String(historyTemperature(entry), 1) + " °C  ";
+          message += "💧 " + String(historyHumidity(entry), 1) + " %\n";
+          // Остальные каналы - пока запись в окне channelHistory
+          int index = channelHistoryIndex(cursor.seq - 1);
+          for (size_t i = 1; i < SENSOR_CHANNELS && index >= 0; i++) {
+            message += "📍 " + String(channelNames[i]) + ": " + String(unpackTemperature(channelHistory.temperature[i][index]), 1) + " °C  ";
+            message += String(unpackHumidity(channelHistory.humidity[i][index]), 1) + " %\n";
+          }
+          message += historyIsRaining(entry) ? "🌧️ *Дождь*\n\n" : "☀️ *Сухо*\n\n";
+        }
+        sendTelegramNotification(message, "Markdown");
+        break;
+      }
+      case TELEGRAM_STATS:
+        sendTelegramNotification(formatTelegramStats(), "Markdown");
+        break;
+      case TELEGRAM_CALIBRATE: {
+        int threshold;
+        if (calibrateRainSensor(&threshold)) {
+          sendTelegramNotification("🔧 *Датчик дождя откалиброван*\nНовый порог: " + String(threshold), "Markdown");
+        } else {
+          sendTelegramNotification("⚠️ *Нет свежих показаний датчика*, калибровка не выполнена", "Markdown");
+        }
+        break;
+      }
+      case TELEGRAM_REBOOT:
+        // Ответом служит уведомление о перезагрузке из loop()
+        shouldReboot = true;
+        break;
     }
   }
 }
@@ -240,6 +775,7 @@ String generateTelegramMenu() {
   menu += "Выберите действие:\n\n";
   menu += "📊 *Текущие показания* - актуальные данные с датчиков\n";
   menu += "⏳ *История данных* - последние измерения\n";
+  menu += "📈 *Статистика* - минимум, максимум и тренд за 1, 6 и 24 часа\n";
   menu += "🔧 *Калибровка* - калибровка датчика дождя\n";
   menu += "🔄 *Перезагрузка* - перезапуск системы\n\n";
   menu += "Для обновления меню нажмите кнопку *Меню*";
@@ -248,17 +784,36 @@ String generateTelegramMenu() {
 
 String generateTelegramKeyboard() {
   String keyboardJson = "[[\"📊 Текущие показания\", \"⏳ История данных\"],";
+  keyboardJson += "[\"📈 Статистика\"],";
   keyboardJson += "[\"🔧 Калибровка\", \"🔄 Перезагрузка\"],";
   keyboardJson += "[\"Меню\"]]";
   return keyboardJson;
 }
 
+// Сообщение в TELEGRAM_CHAT_ID отправляет задача Telegram, здесь оно только
+// ставится в очередь. Если очередь полна, сообщение теряется.
 void sendTelegramNotification(const String &message, const String &parse_mode) {
-  if (WiFi.status() == WL_CONNECTED) {
-    bot.sendMessage(TELEGRAM_CHAT_ID, message, parse_mode);
+  if (telegramOutbox == nullptr) return;
+  TelegramMessage item;
+  item.text = new String(message);
+  strlcpy(item.parseMode, parse_mode.c_str(), sizeof(item.parseMode));
+  telegramPending++;
+  if (xQueueSend(telegramOutbox, &item, 0) != pdTRUE) {
+    delete item.text;
+    telegramPending--;
   }
 }
 
+// Ожидание, пока задача Telegram отправит все из очереди. false - не успела за timeout мс
+bool flushTelegramOutbox(uint32_t timeout) {
+  uint32_t start = millis();
+  while (telegramPending > 0) {
+    if (millis() - start >= timeout) return false;
+    delay(50);
+  }
+  return true;
+}
+
 // ========== Настройки ==========
 void initPreferences() {
   preferences.begin("meteo-station", false);
@@ -289,12 +844,14 @@ void saveWiFiSettings() {
   preferences.putBytes("wifi_ssid", wifiSettings.ssid, strnlen(wifiSettings.ssid, sizeof(wifiSettings.ssid)));
   preferences.putBytes("wifi_pass", wifiSettings.password, strnlen(wifiSettings.password, sizeof(wifiSettings.password)));
   isWiFiConfigured = true;
+  sensorDataVersion++;
 }
 
 void saveOTASettings() {
   preferences.putBytes("ota_user", otaSettings.username, strnlen(otaSettings.username, sizeof(otaSettings.username)));
   preferences.putBytes("ota_pass", otaSettings.password, strnlen(otaSettings.password, sizeof(otaSettings.password)));
   ArduinoOTA.setPassword(otaSettings.password);
+  sensorDataVersion++;
 }
 
 // ========== WiFi Functions ==========
@@ -306,6 +863,13 @@ void connectWiFi() {
 
   WiFi.mode(WIFI_STA);
   WiFi.begin(wifiSettings.ssid, wifiSettings.password);
+  static bool eventsAttached = false;
+  if (!eventsAttached) {
+    WiFi.onEvent(onWiFiEvent, ARDUINO_EVENT_WIFI_STA_GOT_IP);
+    WiFi.onEvent(onWiFiEvent, ARDUINO_EVENT_WIFI_STA_LOST_IP);
+    WiFi.onEvent(onWiFiEvent, ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+    eventsAttached = true;
+  }
   
   Serial.print("Подключение к ");
   Serial.println(wifiSettings.ssid);
@@ -331,6 +895,7 @@ void activateAPMode() {
   WiFi.mode(WIFI_AP);
   WiFi.softAP(wifiSettings.ssid, wifiSettings.password);
   isAPMode = true;
+  sensorDataVersion++;
   
   Serial.print("Точка доступа: ");
   Serial.println(wifiSettings.ssid);
@@ -339,7 +904,17 @@ void activateAPMode() {
   Serial.println("IP адрес: " + WiFi.softAPIP().toString());
 }
 
+// Вызывается из задачи событий WiFi: версия данных меняется только в loop()
+void onWiFiEvent(arduino_event_id_t event, arduino_event_info_t info) {
+  networkChanged = true;
+}
+
 void checkWiFi() {
+  // IP и RSSI входят в кешированный ответ /sensor-data
+  if (networkChanged.exchange(false)) {
+    sensorDataVersion++;
+  }
+  
   static unsigned long lastCheck = 0;
   if (millis() - lastCheck > 10000) { // Проверка каждые 10 секунд
     if (WiFi.status() != WL_CONNECTED && !isAPMode) {
@@ -350,527 +925,1829 @@ void checkWiFi() {
   }
 }
 
-// ========== Sensor Functions ==========
-void readSensors() {
-  static unsigned long lastRead = 0;
-  if (millis() - lastRead < 2000) return; // Чтение не чаще чем раз в 2 секунды
-  
-  // Медианный фильтр для DHT (3 измерения)
-  float tempBuffer[3];
-  float humBuffer[3];
-  
-  for (int i = 0; i < 3; i++) {
-    tempBuffer[i] = dht.readTemperature();
-    humBuffer[i] = dht.readHumidity();
-    delay(100);
+// ========== Sensor Task ==========
+// Задача владеет датчиками (ClimateSensors, RainSensor) и работает на ядре SENSOR_TASK_CORE.
+// Датчик дождя будит задачу по готовности данных, они усредняются в значения
+// за RAIN_DECIMATION_MS, по последним из них ведется статистика для калибровки,
+// и каждое проходит через RainDetector.
+// Датчики климата опрашиваются с переменным периодом, тогда же публикуется снимок:
+// при заметном изменении показаний период SENSOR_SAMPLE_INTERVAL_MIN, пока они
+// стабильны - удваивается до SENSOR_SAMPLE_INTERVAL_MAX. Резкое изменение сигнала
+// дождя вызывает измерение, не дожидаясь конца паузы. Остальной код только читает снимок.
+void sensorTask(void *parameter) {
+  ClimateSensors climate;
+  RainSensor rain;
+  
+  // Медианы по каналам; ошибки чтения (NAN) в фильтры не попадают
+  SlidingMedian<float, SENSOR_MEDIAN_WINDOW> temperatures[SENSOR_CHANNELS];
+  SlidingMedian<float, SENSOR_MEDIAN_WINDOW> humidities[SENSOR_CHANNELS];
+  SlidingMedian<float, SENSOR_MEDIAN_WINDOW> pressures[SENSOR_CHANNELS];
+  
+  // Значения датчика дождя: отбраковка выбросов, затем сглаживание
+  HampelFilter<int, RAIN_HAMPEL_WINDOW> rainOutliers(3.0f, RAIN_HAMPEL_MIN_DEVIATION);
+  EmaFilter<int> rainSmoothing(RAIN_EMA_ALPHA);
+  RainDetector rainDetector(RAIN_ON_DWELL_MS, RAIN_OFF_DWELL_MS, RAIN_DRIFT_ALPHA, RAIN_INTENSITY_ALPHA, RAIN_OFF_PERCENT);
+  int appliedOnDelta = rainOnDelta;
+  
+  // Окно значений датчика дождя с суммами для среднего и отклонения
+  int rainValues[RAIN_CALIBRATION_SAMPLES];
+  uint8_t rainIndex = 0, rainFilled = 0;
+  int64_t rainSum = 0, rainSumSquares = 0;
+  int rainValue = 0;
+  
+  uint8_t found = climate.begin();
+  for (size_t i = 0; i < SENSOR_CHANNELS; i++) {
+    if (!(found & (1 << i))) {
+      Serial.println("Датчик климата не отвечает: " + String(channelNames[i]));
+    }
   }
-  
-  // Сортировка для медианы
-  std::sort(tempBuffer, tempBuffer + 3);
-  std::sort(humBuffer, humBuffer + 3);
-  
-  sensorData.temperature = tempBuffer[1];
-  sensorData.humidity = humBuffer[1];
-  
-  // Чтение датчика дождя
-  sensorData.rainValue = analogRead(RAIN_SENSOR_PIN);
-  sensorData.isRaining = sensorData.rainValue > sensorData.rainThreshold;
-  
-  // Получение времени
-  struct tm timeinfo;
-  if (getLocalTime(&timeinfo)) {
-    char timeStr[20];
-    strftime(timeStr, sizeof(timeStr), "%H:%M %d.%m", &timeinfo);
-    sensorData.lastUpdate = String(timeStr);
-  } else {
-    sensorData.lastUpdate = "--:-- --.--";
+  rain.begin();
+  Serial.println(rain.continuous() ? "АЦП дождя: непрерывный режим" : "АЦП дождя: опрос");
+  
+  TickType_t decimationTick = xTaskGetTickCount();
+  // Первое измерение - когда окно статистики заполнится, чтобы калибровка при запуске была точной
+  TickType_t nextSample = decimationTick + pdMS_TO_TICKS(RAIN_CALIBRATION_SAMPLES * RAIN_DECIMATION_MS);
+  TickType_t lastSample = decimationTick;
+  TickType_t interval = pdMS_TO_TICKS(SENSOR_SAMPLE_INTERVAL_MIN);
+  uint32_t sample = 0;
+  SensorData previous = {};
+  
+  for (;;) {
+    TickType_t now = xTaskGetTickCount();
+    TickType_t untilSample = (int32_t)(nextSample - now) > 0 ? nextSample - now : 0;
+    TickType_t untilDecimation = pdMS_TO_TICKS(RAIN_DECIMATION_MS) - std::min<TickType_t>(now - decimationTick, pdMS_TO_TICKS(RAIN_DECIMATION_MS));
+    rain.wait(std::min(untilSample, untilDecimation));
+    
+    now = xTaskGetTickCount();
+    if (now - decimationTick >= pdMS_TO_TICKS(RAIN_DECIMATION_MS)) {
+      decimationTick = now;
+      int rawRain;
+      if (rain.take(rawRain)) {
+        int filtered = rainOutliers.update(rawRain);
+        rainValue = rainSmoothing.update(filtered);
+        
+        // Статистика для калибровки - по значениям без выбросов, но без запаздывания EMA
+        if (rainFilled == RAIN_CALIBRATION_SAMPLES) {
+          rainSum -= rainValues[rainIndex];
+          rainSumSquares -= (int64_t)rainValues[rainIndex] * rainValues[rainIndex];
+        } else {
+          rainFilled++;
+        }
+        rainValues[rainIndex] = filtered;
+        rainSum += filtered;
+        rainSumSquares += (int64_t)filtered * filtered;
+        rainIndex = (rainIndex + 1) % RAIN_CALIBRATION_SAMPLES;
+        
+        // Настройки приходят из loop(): новый порог и уровень после калибровки
+        int baseline = rainBaselineRequest.exchange(-1);
+        int onDelta = rainOnDelta;
+        bool settingsChanged = baseline >= 0 || onDelta != appliedOnDelta;
+        if (baseline >= 0) rainDetector.setBaseline(baseline);
+        rainDetector.setOnDelta(onDelta);
+        appliedOnDelta = onDelta;
+        bool rainChanged = rainDetector.update(rainValue, millis());
+        
+        // Дождь начался или закончился, сменились настройки - измерение как можно раньше
+        if (sample > 0 && (rainChanged || settingsChanged || abs(rainValue - previous.rainValue) >= RAIN_ACTIVITY_DELTA) &&
+            (int32_t)(nextSample - (lastSample + pdMS_TO_TICKS(SENSOR_SAMPLE_INTERVAL_MIN))) > 0) {
+          nextSample = lastSample + pdMS_TO_TICKS(SENSOR_SAMPLE_INTERVAL_MIN);
+        }
+      }
+    }
+    
+    if ((int32_t)(now - nextSample) < 0) continue;
+    uint32_t start = micros();
+    
+    ClimateReading readings[SENSOR_CHANNELS];
+    climate.read(readings);
+    
+    time_t epoch = time(nullptr);
+    SensorData data = {};
+    for (size_t i = 0; i < SENSOR_CHANNELS; i++) {
+      if (!isnan(readings[i].temperature)) temperatures[i].push(readings[i].temperature);
+      if (!isnan(readings[i].humidity)) humidities[i].push(readings[i].humidity);
+      if (!isnan(readings[i].pressure)) pressures[i].push(readings[i].pressure);
+      data.temperature[i] = temperatures[i].empty() ? NAN : temperatures[i].value();
+      data.humidity[i] = humidities[i].empty() ? NAN : humidities[i].value();
+      data.pressure[i] = pressures[i].empty() ? NAN : pressures[i].value();
+    }
+    data.rainValue = rainValue;
+    data.isRaining = rainDetector.raining();
+    data.rainIntensity = rainDetector.intensity();
+    data.rainBaseline = rainDetector.baseline();
+    data.rainThreshold = rainDetector.onThreshold();
+    if (rainFilled > 0) {
+      double mean = (double)rainSum / rainFilled;
+      data.rainAverage = lround(mean);
+      data.rainDeviation = sqrt(std::max(0.0, (double)rainSumSquares / rainFilled - mean * mean));
+    }
+    data.epoch = epoch > MIN_VALID_EPOCH ? (uint32_t)epoch : 0;
+    
+    // Темп опроса по изменению с прошлого измерения (NAN изменением не считается)
+    bool active = sample == 0 || data.isRaining != previous.isRaining || abs(rainValue - previous.rainValue) >= RAIN_ACTIVITY_DELTA;
+    for (size_t i = 0; i < SENSOR_CHANNELS; i++) {
+      active = active || fabsf(data.temperature[i] - previous.temperature[i]) >= SENSOR_ACTIVITY_TEMPERATURE ||
+               fabsf(data.humidity[i] - previous.humidity[i]) >= SENSOR_ACTIVITY_HUMIDITY;
+    }
+    interval = active ? pdMS_TO_TICKS(SENSOR_SAMPLE_INTERVAL_MIN) : std::min<TickType_t>(interval * 2, pdMS_TO_TICKS(SENSOR_SAMPLE_INTERVAL_MAX));
+    lastSample = now;
+    nextSample = now + interval;
+    
+    data.sample = ++sample;
+    data.sampledAt = millis();
+    data.sampleInterval = interval * portTICK_PERIOD_MS;
+    writeSensorSnapshot(data);
+    previous = data;
+    
+    loopStats.sensorStepMaxUs = std::max<uint32_t>(loopStats.sensorStepMaxUs, micros() - start);
   }
-  
-  lastRead = millis();
 }
 
-void calibrateRainSensor() {
-  int sum = 0;
-  for (int i = 0; i < 10; i++) {
-    sum += analogRead(RAIN_SENSOR_PIN);
-    delay(100);
+void writeSensorSnapshot(const SensorData &data) {
+  uint32_t seq = sensorSnapshot.seq.load(std::memory_order_relaxed);
+  sensorSnapshot.seq.store(seq + 1, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  sensorSnapshot.data = data;
+  sensorSnapshot.seq.store(seq + 2, std::memory_order_release);
+}
+
+// Чтение без блокировок: запись занимает доли микросекунды, поэтому повтор редкость
+SensorData readSensorSnapshot() {
+  SensorData data;
+  uint32_t before, after;
+  do {
+    before = sensorSnapshot.seq.load(std::memory_order_acquire);
+    data = sensorSnapshot.data;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    after = sensorSnapshot.seq.load(std::memory_order_relaxed);
+  } while (before != after || (before & 1));
+  return data;
+}
+
+// Неблокирующее чтение с условием свежести: данные копируются всегда,
+// false - измерений еще не было или последнее старше maxAge мс
+bool readFreshSensorSnapshot(SensorData &data, uint32_t maxAge) {
+  data = readSensorSnapshot();
+  return data.sample > 0 && sensorDataAge(data) <= maxAge;
+}
+
+// Возраст снимка в мс, UINT32_MAX - измерений еще не было
+uint32_t sensorDataAge(const SensorData &data) {
+  return data.sample > 0 ? millis() - data.sampledAt : UINT32_MAX;
+}
+
+void formatSensorAge(const SensorData &data, char *buf, size_t size) {
+  uint32_t age = sensorDataAge(data);
+  if (age == UINT32_MAX) {
+    snprintf(buf, size, "нет данных");
+  } else {
+    snprintf(buf, size, "%lu с назад", (unsigned long)(age / 1000));
   }
-  sensorData.rainThreshold = (sum / 10) + 100;
-  Serial.println("Датчик дождя откалиброван. Порог: " + String(sensorData.rainThreshold));
 }
 
-void saveHistory() {
-  // Добавляем запись в историю
-  if (sensorHistory.count < HISTORY_SIZE) {
-    sensorHistory.count++;
+// Вызывается из loop(): при новом измерении обновляет версию ответа /sensor-data
+// и рассылает показания подписчикам, если они изменились
+void pollSensorSnapshot() {
+  static uint32_t lastSeq = 0;
+  static SensorData published = {};
+  
+  uint32_t seq = sensorSnapshot.seq.load(std::memory_order_acquire);
+  if (seq == lastSeq || (seq & 1)) return;
+  lastSeq = seq;
+  
+  SensorData data = readSensorSnapshot();
+  // Время в ответе выводится с точностью до минуты
+  bool changed = data.rainValue != published.rainValue || data.epoch / 60 != published.epoch / 60 ||
+                 data.isRaining != published.isRaining || data.rainIntensity != published.rainIntensity ||
+                 data.rainThreshold != published.rainThreshold;
+  for (size_t i = 0; i < SENSOR_CHANNELS; i++) {
+    changed = changed || !sameReading(data.temperature[i], published.temperature[i]) ||
+              !sameReading(data.humidity[i], published.humidity[i]) ||
+              !sameReading(data.pressure[i], published.pressure[i]);
   }
+  if (!changed) return;
+  published = data;
+  sensorDataVersion++;
   
-  // Запись в текущий индекс
-  sensorHistory.records[sensorHistory.index] = {
-    sensorData.temperature,
-    sensorData.humidity,
-    sensorData.isRaining,
-    sensorData.lastUpdate
-  };
-  
-  // Обновление индекса
-  sensorHistory.index = (sensorHistory.index + 1) % HISTORY_SIZE;
+  publishSensorEvent();
   
-  Serial.println("Данные сохранены в историю: " + sensorData.lastUpdate);
+  // Кадр собирается один раз и рассылается всем клиентам WebSocket
+  if (telemetrySocket.connectedClients() > 0) {
+    TelemetryFrame frame;
+    fillTelemetryFrame(frame);
+    telemetrySocket.broadcastBIN((const uint8_t *)&frame, sizeof(frame));
+  }
 }
 
-// ========== Security Functions ==========
-void generateCsrfToken() {
-  const char charset[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
-  csrfToken = "";
-  
-  for (int i = 0; i < CSRF_TOKEN_LENGTH; i++) {
-    csrfToken += charset[random(0, sizeof(charset) - 1)];
+// Равенство показаний с учетом NAN (нет данных)
+bool sameReading(float a, float b) {
+  return a == b || (isnan(a) && isnan(b));
+}
+
+// slot - только этому подписчику (первое событие после подключения), -1 - всем
+void publishSensorEvent(int slot) {
+  if (activeEventClients() == 0) return;
+  DynamicJsonDocument doc(SENSOR_JSON_SIZE);
+  fillSensorJson(doc);
+  String json;
+  serializeJson(doc, json);
+  publishEvent("sensor", json.c_str(), slot);
+}
+
+// Уровень сухого датчика - среднее отфильтрованного сигнала за последнюю секунду,
+// АЦП здесь не читается. Задача опроса примет его со следующим значением и дальше
+// будет следить за дрейфом сама. Без свежего снимка возвращается false.
+// threshold - новый порог включения
+bool calibrateRainSensor(int *threshold) {
+  SensorData data;
+  if (!readFreshSensorSnapshot(data, SENSOR_MAX_AGE)) {
+    return false;
   }
+  rainBaselineRequest = data.rainAverage;
+  if (threshold) *threshold = data.rainAverage + rainOnDelta;
+  Serial.println("Датчик дождя откалиброван. Порог: " + String(data.rainAverage + rainOnDelta) +
+                 " (среднее " + String(data.rainAverage) + ", отклонение " + String(data.rainDeviation, 1) + ")");
+  return true;
 }
 
-bool validateCsrf() {
-  if (server.method() == HTTP_GET) return true;
-  return server.hasArg("csrf") && server.arg("csrf") == csrfToken;
+const char *rainIntensityName(uint8_t intensity) {
+  switch (intensity) {
+    case RAIN_LIGHT: return "слабый";
+    case RAIN_MODERATE: return "умеренный";
+    case RAIN_HEAVY: return "сильный";
+    default: return "нет";
+  }
+}
+
+void saveHistory(const SensorData &data, time_t epoch) {
+  // Кеш JSON хранит последние HISTORY_SIZE записей: если он полон, самая старая уходит
+  bool cacheFull = sensorHistory.count >= HISTORY_SIZE;
+  HistoryRecord entry = packHistoryRecord(data, epoch);
+  lastHistorySave = millis();
+  
+  historyHeadSeq++;
+  channelHistoryAppend(historyHeadSeq, data, entry.epoch);
+  const HistoryBlock *sealed = historyStoreAppend(historyHeadSeq, entry);
+  historyLogAppend(historyHeadSeq, entry, sealed);
+  addToRollups(entry);
+  addToStats(entry);
+  
+  char timeStr[20];
+  formatEpochTime(entry.epoch, timeStr, sizeof(timeStr));
+  Serial.println("Данные сохранены в историю: " + String(timeStr));
+  
+  // Запись сериализуется один раз: для кеша /history-data и для /events
+  char recordJson[HISTORY_RECORD_JSON_SIZE];
+  serializeHistoryRecord(entry, historyHeadSeq, recordJson, sizeof(recordJson));
+  appendHistoryJsonCache(recordJson, cacheFull);
+  
+  if (activeEventClients() > 0) {
+    publishEvent("history", recordJson);
+  }
 }
 
-// ========== Web Interface ==========
-String generateHTML() {
-  // Динамический расчет размера HTML
-  size_t htmlSize = 7000 + sensorHistory.count * 120;
-  String html;
-  html.reserve(htmlSize);
-  
-  // HTML Head
-  html = "<!DOCTYPE html><html lang=\"ru\"><head>";
-  html += "<meta charset=\"UTF-8\">";
-  html += "<meta name=\"viewport\" content=\"width=device-width, initial-scale=1.0\">";
-  html += "<title>Метеостанция</title>";
-  html += "<link href=\"https://fonts.googleapis.com/css2?family=Montserrat:wght@400;600;700&display=swap\" rel=\"stylesheet\">";
-  html += "<link rel=\"stylesheet\" href=\"https://cdnjs.cloudflare.com/ajax/libs/font-awesome/6.4.0/css/all.min.css\">";
-  html += "<script src=\"https://cdn.jsdelivr.net/npm/chart.js\"></script>";
-  html += "<style>";
-  html += ":root {";
-  html += "--primary: #4361ee;";
-  html += "--secondary: #3f37c9;";
-  html += "--accent: #4895ef;";
-  html += "--danger: #f72585;";
-  html += "--success: #4cc9f0;";
-  html += "--warning: #f8961e;";
-  html += "--light: #f8f9fa;";
-  html += "--dark: #212529;";
-  html += "--gray: #6c757d;";
-  html += "}";
-  
-  html += "* { box-sizing: border-box; margin: 0; padding: 0; }";
-  html += "body { font-family: 'Montserrat', sans-serif; background: linear-gradient(135deg, #f5f7fa 0%, #c3cfe2 100%); color: var(--dark); min-height: 100vh; }";
-  html += ".container { max-width: 1200px; margin: 0 auto; padding: 20px; }";
-  html += "header { text-align: center; padding: 30px 0; margin-bottom: 30px; }";
-  html += "header h1 { font-size: 2.5rem; margin-bottom: 10px; color: var(--primary); font-weight: 700; }";
-  html += "header p { font-size: 1.1rem; color: var(--gray); }";
-  html += ".dashboard { display: grid; grid-template-columns: repeat(auto-fit, minmax(280px, 1fr)); gap: 20px; margin-bottom: 30px; }";
-  html += ".card { background: white; border-radius: 15px; padding: 25px; box-shadow: 0 10px 20px rgba(0,0,0,0.1); transition: transform 0.3s, box-shadow 0.3s; }";
-  html += ".card:hover { transform: translateY(-5px); box-shadow: 0 15px 30px rgba(0,0,0,0.15); }";
-  html += ".card-header { display: flex; align-items: center; margin-bottom: 20px; padding-bottom: 15px; border-bottom: 1px solid rgba(0,0,0,0.05); }";
-  html += ".card-header i { font-size: 1.8rem; margin-right: 15px; color: var(--accent); }";
-  html += ".card-header h2 { font-size: 1.3rem; font-weight: 600; color: var(--primary); }";
-  html += ".card-body { display: flex; flex-direction: column; }";
-  html += ".card-value { font-size: 2.5rem; font-weight: 700; margin: 10px 0; color: var(--secondary); }";
-  html += ".card-status { display: inline-block; padding: 8px 15px; border-radius: 20px; font-weight: 600; color: white; margin-top: 10px; }";
-  html += ".status-rain { background: linear-gradient(to right, var(--accent), var(--primary)); }";
-  html += ".status-dry { background: linear-gradient(to right, var(--warning), var(--danger)); }";
-  html += ".card-description { color: var(--gray); font-size: 0.9rem; margin-top: 5px; }";
-  html += ".controls { display: grid; grid-template-columns: repeat(auto-fit, minmax(280px, 1fr)); gap: 20px; margin-bottom: 30px; }";
-  html += ".control-panel { background: white; border-radius: 15px; padding: 25px; box-shadow: 0 10px 20px rgba(0,0,0,0.1); }";
-  html += ".control-panel h3 { font-size: 1.3rem; margin-bottom: 20px; color: var(--primary); font-weight: 600; }";
-  html += ".form-group { margin-bottom: 15px; }";
-  html += ".form-group label { display: block; margin-bottom: 8px; font-weight: 600; color: var(--dark); }";
-  html += ".form-control { width: 100%; padding: 12px 15px; border: 1px solid #ddd; border-radius: 8px; font-size: 1rem; transition: border 0.3s; }";
-  html += ".form-control:focus { outline: none; border-color: var(--accent); }";
-  html += ".btn { display: inline-block; padding: 12px 25px; background: var(--primary); color: white; border: none; border-radius: 8px; font-size: 1rem; font-weight: 600; cursor: pointer; transition: background 0.3s, transform 0.2s; text-align: center; }";
-  html += ".btn:hover { background: var(--secondary); transform: translateY(-2px); }";
-  html += ".btn-block { display: block; width: 100%; }";
-  html += ".btn-danger { background: var(--danger); }";
-  html += ".btn-danger:hover { background: #d1144a; }";
-  html += ".info-bar { display: flex; justify-content: space-between; background: white; padding: 15px 25px; border-radius: 10px; margin-bottom: 20px; box-shadow: 0 5px 15px rgba(0,0,0,0.05); }";
-  html += ".info-item { display: flex; align-items: center; }";
-  html += ".info-item i { margin-right: 8px; color: var(--accent); }";
-  html += ".alert { padding: 15px; border-radius: 10px; margin-bottom: 20px; background: #fff3cd; color: #856404; border-left: 5px solid #ffeeba; }";
-  html += ".alert-warning { background: #fff3cd; color: #856404; border-left-color: #ffeeba; }";
-  html += ".alert-danger { background: #f8d7da; color: #721c24; border-left-color: #f5c6cb; }";
-  html += "table { width: 100%; border-collapse: collapse; margin-bottom: 15px; }";
-  html += "th, td { padding: 10px; text-align: left; border-bottom: 1px solid #ddd; }";
-  html += "tr:nth-child(even) { background-color: #f9f9f9; }";
-  html += ".chart-container { height: 300px; margin-bottom: 20px; }";
-  html += ".history-container { max-height: 300px; overflow-y: auto; margin-bottom: 15px; }";
-  html += "footer { text-align: center; padding: 20px 0; color: var(--gray); font-size: 0.9rem; }";
-  html += "@media (max-width: 768px) { .dashboard, .controls { grid-template-columns: 1fr; } .info-bar { flex-direction: column; gap: 10px; } }";
-  html += "@media (pointer: coarse) { .btn { padding: 15px 30px; min-height: 50px; } }";
-  html += "</style></head><body>";
-  html += "<div class=\"container\">";
-  
-  // Header
-  html += "<header><h1><i class=\"fas fa-cloud-sun\"></i> Умная метеостанция</h1>";
-  html += "<p>Мониторинг погодных условий в реальном времени</p></header>";
-  
-  // Alert if in AP mode
-  if (isAPMode) {
-    html += "<div class=\"alert alert-warning\">";
-    html += "<h3><i class=\"fas fa-exclamation-triangle\"></i> Режим настройки WiFi</h3>";
-    html += "<p>Устройство не подключено к WiFi. Пожалуйста, настройте подключение.</p>";
-    html += "</div>";
-  }
-
-  // Info bar
-  html += "<div class=\"info-bar\">";
-  html += "<div class=\"info-item\"><i class=\"fas fa-wifi\"></i> ";
-  html += isAPMode ? WiFi.softAPIP().toString() : WiFi.localIP().toString();
-  html += "</div>";
-  html += "<div class=\"info-item\"><i class=\"fas fa-clock\"></i> Последнее обновление: ";
-  html += sensorData.lastUpdate;
-  html += "</div>";
-  html += "<div class=\"info-item\"><i class=\"fas fa-signal\"></i> ";
-  html += isAPMode ? "Точка доступа" : String(WiFi.RSSI()) + " dBm";
-  html += "</div>";
-  html += "</div>";
-
-  // Dashboard cards
-  html += "<div class=\"dashboard\">";
-  html += "<div class=\"card temperature\"><div class=\"card-header\"><i class=\"fas fa-thermometer-half\"></i><h2>Температура</h2></div>";
-  html += "<div class=\"card-body\"><div class=\"card-value\">";
-  html += String(sensorData.temperature, 1);
-  html += " °C</div><p class=\"card-description\">Текущая температура окружающей среды</p></div></div>";
-  
-  html += "<div class=\"card humidity\"><div class=\"card-header\"><i class=\"fas fa-tint\"></i><h2>Влажность</h2></div>";
-  html += "<div class=\"card-body\"><div class=\"card-value\">";
-  html += String(sensorData.humidity, 1);
-  html += " %</div><p class=\"card-description\">Относительная влажность воздуха</p></div></div>";
-  
-  html += "<div class=\"card rain\"><div class=\"card-header\"><i class=\"fas fa-cloud-rain\"></i><h2>Дождь</h2></div>";
-  html += "<div class=\"card-body\"><div class=\"card-value\">";
-  html += String(sensorData.rainValue);
-  html += "</div><div class=\"card-status ";
-  html += sensorData.isRaining ? "status-rain" : "status-dry";
-  html += "\">";
-  html += sensorData.isRaining ? "<i class=\"fas fa-umbrella\"></i> Идёт дождь" : "<i class=\"fas fa-sun\"></i> Без осадков";
-  html += "</div><p class=\"card-description\">Порог: ";
-  html += String(sensorData.rainThreshold);
-  html += "</p></div></div></div>";
-  
-  // Control panels
-  html += "<div class=\"controls\">";
-  
-  // WiFi Settings panel
-  html += "<div class=\"control-panel\"><h3><i class=\"fas fa-wifi\"></i> Настройки WiFi</h3>";
-  html += "<form action=\"/savewifi\" method=\"post\">";
-  html += "<input type=\"hidden\" name=\"csrf\" value=\"" + csrfToken + "\">";
-  html += "<div class=\"form-group\"><label for=\"ssid\">Имя сети (SSID)</label>";
-  html += "<input type=\"text\" class=\"form-control\" id=\"ssid\" name=\"ssid\" value=\"";
-  html += wifiSettings.ssid;
-  html += "\" maxlength=\"" + String(MAX_SSID_LENGTH - 1) + "\" required></div>";
-  html += "<div class=\"form-group\"><label for=\"password\">Пароль</label>";
-  html += "<input type=\"password\" class=\"form-control\" id=\"password\" name=\"password\" value=\"";
-  html += wifiSettings.password;
-  html += "\" maxlength=\"" + String(MAX_PASSWORD_LENGTH - 1) + "\" placeholder=\"Введите пароль\"></div>";
-  html += "<button type=\"submit\" class=\"btn btn-block\"><i class=\"fas fa-save\"></i> Сохранить</button>";
-  html += "</form></div>";
-  
-  // Time and Sensors panel
-  html += "<div class=\"control-panel\"><h3><i class=\"fas fa-cog\"></i> Системные настройки</h3>";
-  html += "<form action=\"/settz\" method=\"get\">";
-  html += "<div class=\"form-group\"><label for=\"tz\">Часовой пояс</label>";
-  html += "<select class=\"form-control\" name=\"tz\" id=\"tz\">";
-  
-  for (int i = -12; i <= 14; i++) {
-    html += "<option value=\"";
-    html += String(i);
-    html += "\"";
-    if (i == timeZoneOffset) html += " selected";
-    html += ">UTC";
-    if (i >= 0) html += "+";
-    html += String(i);
-    html += "</option>";
-  }
-  
-  html += "</select></div>";
-  html += "<div class=\"form-group\"><label for=\"rain_threshold\">Порог дождя</label>";
-  html += "<input type=\"number\" class=\"form-control\" id=\"rain_threshold\" name=\"rain_threshold\" value=\"";
-  html += String(sensorData.rainThreshold);
-  html += "\"></div>";
-  html += "<button type=\"submit\" class=\"btn btn-block\"><i class=\"fas fa-clock\"></i> Обновить</button>";
-  html += "</form>";
-  html += "<form action=\"/calibrate\" method=\"get\" style=\"margin-top: 10px;\">";
-  html += "<button type=\"submit\" class=\"btn btn-block\"><i class=\"fas fa-bolt\"></i> Калибровать датчик</button>";
-  html += "</form></div>";
-  
-  // OTA and System panel
-  html += "<div class=\"control-panel\"><h3><i class=\"fas fa-power-off\"></i> Система</h3>";
-  html += "<form action=\"/saveota\" method=\"post\">";
-  html += "<input type=\"hidden\" name=\"csrf\" value=\"" + csrfToken + "\">";
-  html += "<div class=\"form-group\"><label for=\"ota_user\">OTA Логин</label>";
-  html += "<input type=\"text\" class=\"form-control\" id=\"ota_user\" name=\"ota_user\" value=\"";
-  html += otaSettings.username;
-  html += "\" maxlength=\"" + String(MAX_SSID_LENGTH - 1) + "\" required></div>";
-  html += "<div class=\"form-group\"><label for=\"ota_pass\">OTA Пароль</label>";
-  html += "<input type=\"password\" class=\"form-control\" id=\"ota_pass\" name=\"ota_pass\" value=\"";
-  html += otaSettings.password;
-  html += "\" maxlength=\"" + String(MAX_PASSWORD_LENGTH - 1) + "\" required></div>";
-  html += "<button type=\"submit\" class=\"btn btn-block\"><i class=\"fas fa-save\"></i> Сохранить</button>";
-  html += "</form>";
-  html += "<form action=\"/update\" method=\"get\" style=\"margin-top: 10px;\">";
-  html += "<button type=\"submit\" class=\"btn btn-block\"><i class=\"fas fa-cloud-upload-alt\"></i> OTA Обновление</button>";
-  html += "</form>";
-  html += "<form action=\"/reset\" method=\"get\" style=\"margin-top: 10px;\">";
-  html += "<button type=\"submit\" class=\"btn btn-block btn-danger\"><i class=\"fas fa-sync-alt\"></i> Перезагрузить</button>";
-  html += "</form></div>";
-  
-  html += "</div>"; // Close controls div
-  
-  // History panel with chart
-  html += "<div class=\"control-panel\" style=\"grid-column: 1 / -1;\"><h3><i class=\"fas fa-history\"></i> История измерений</h3>";
-  html += "<div class=\"chart-container\"><canvas id=\"historyChart\"></canvas></div>";
-  
-  // History table
-  html += "<div class=\"history-container\">";
-  html += "<table><thead><tr><th>Время</th><th>Темп.</th><th>Влажн.</th><th>Дождь</th></tr></thead><tbody>";
-
-  for (int i = 0; i < sensorHistory.count; i++) {
-    int idx = (sensorHistory.index - sensorHistory.count + i + HISTORY_SIZE) % HISTORY_SIZE;
-    html += "<tr>";
-    html += "<td>"; html += sensorHistory.records[idx].timestamp; html += "</td>";
-    html += "<td>"; html += String(sensorHistory.records[idx].temperature, 1); html += " °C</td>";
-    html += "<td>"; html += String(sensorHistory.records[idx].humidity, 1); html += " %</td>";
-    html += "<td>"; 
-    html += sensorHistory.records[idx].isRaining ? "Да" : "Нет"; 
-    html += "</td>";
-    html += "</tr>";
-  }
-
-  html += "</tbody></table></div>";
-  html += "<button onclick=\"location.reload()\" class=\"btn btn-block\"><i class=\"fas fa-sync-alt\"></i> Обновить</button>";
-  html += "</div>";
-  
-  // Footer
-  html += "<footer><p><i class=\"fas fa-code\"></i> Умная метеостанция © 2023 | Версия 2.9</p></footer>";
-  html += "</div>"; // Close container
-  
-  // JavaScript
-  html += "<script>";
-  html += "const historyChartConfig = {";
-  html += "type: 'line',";
-  html += "data: {";
-  html += "datasets: [{";
-  html += "label: 'Температура (°C)',";
-  html += "borderColor: '#4361ee',";
-  html += "backgroundColor: 'rgba(67, 97, 238, 0.1)',";
-  html += "borderWidth: 2,";
-  html += "yAxisID: 'y'";
-  html += "}, {";
-  html += "label: 'Влажность (%)',";
-  html += "borderColor: '#4cc9f0',";
-  html += "backgroundColor: 'rgba(76, 201, 240, 0.1)',";
-  html += "borderWidth: 2,";
-  html += "yAxisID: 'y1'";
-  html += "}]";
-  html += "},";
-  html += "options: {";
-  html += "responsive: true,";
-  html += "maintainAspectRatio: false,";
-  html += "interaction: { mode: 'index' },";
-  html += "scales: {";
-  html += "y: {";
-  html += "type: 'linear',";
-  html += "display: true,";
-  html += "position: 'left',";
-  html += "title: { display: true, text: 'Температура (°C)' },";
-  html += "grid: { drawOnChartArea: true }";
-  html += "},";
-  html += "y1: {";
-  html += "type: 'linear',";
-  html += "display: true,";
-  html += "position: 'right',";
-  html += "min: 0,";
-  html += "max: 100,";
-  html += "title: { display: true, text: 'Влажность (%)' },";
-  html += "grid: { drawOnChartArea: false }";
-  html += "}";
-  html += "}";
-  html += "}";
-  html += "};";
-  
-  html += "let historyChart = new Chart(";
-  html += "document.getElementById('historyChart'),";
-  html += "historyChartConfig";
-  html += ");";
-  
-  html += "function updateSensorData() {";
-  html += "fetch('/sensor-data').then(r => r.json()).then(data => {";
-  html += "document.querySelector('.temperature .card-value').textContent = data.temp + ' °C';";
-  html += "document.querySelector('.humidity .card-value').textContent = data.hum + ' %';";
-  html += "const rainValue = document.querySelector('.rain .card-value');";
-  html += "const rainStatus = document.querySelector('.rain .card-status');";
-  html += "rainValue.textContent = data.rainValue;";
-  html += "rainStatus.innerHTML = data.rain ? '<i class=\"fas fa-umbrella\"></i> Идёт дождь' : '<i class=\"fas fa-sun\"></i> Без осадков';";
-  html += "rainStatus.className = data.rain ? 'card-status status-rain' : 'card-status status-dry';";
-  html += "document.querySelector('.rain .card-description').textContent = 'Порог: ' + data.threshold;";
-  html += "document.querySelector('.info-item:nth-child(2)').innerHTML = '<i class=\"fas fa-clock\"></i> Последнее обновление: ' + data.time;";
-  html += "}).catch(e => console.error(e));";
-  html += "}";
-  
-  html += "function updateHistory() {";
-  html += "fetch('/history-data').then(r => r.json()).then(data => {";
-  html += "const tbody = document.querySelector('tbody');";
-  html += "tbody.innerHTML = '';";
-  html += "data.history.forEach(record => {";
-  html += "const row = document.createElement('tr');";
-  html += "row.innerHTML = `";
-  html += "<td>${record.time}</td>";
-  html += "<td>${record.temp} °C</td>";
-  html += "<td>${record.hum} %</td>";
-  html += "<td>${record.rain ? 'Да' : 'Нет'}</td>";
-  html += "`;";
-  html += "tbody.appendChild(row);";
-  html += "});";
-  
-  // Обновление графика с правильными данными
-  html += "const labels = [];";
-  html += "const tempData = [];";
-  html += "const humData = [];";
-  html += "for(let i = data.history.length - 1; i >= 0; i--) {";
-  html += "labels.push(data.history[i].time);";
-  html += "tempData.push(data.history[i].temp);";
-  html += "humData.push(data.history[i].hum);";
-  html += "}";
-  html += "historyChart.data.labels = labels;";
-  html += "historyChart.data.datasets[0].data = tempData;";
-  html += "historyChart.data.datasets[1].data = humData;";
-  html += "historyChart.update();";
-  html += "}).catch(e => console.error(e));";
-  html += "}";
-  
-  html += "document.addEventListener('DOMContentLoaded', () => {";
-  html += "updateSensorData();";
-  html += "updateHistory();";
-  html += "setInterval(updateSensorData, 30000);";
-  html += "setInterval(updateHistory, 60000);";
-  html += "});";
-  html += "</script></body></html>";
-
-  return html;
+HistoryRecord packHistoryRecord(const SensorData &data, time_t epoch) {
+  HistoryRecord entry;
+  entry.epoch = epoch > MIN_VALID_EPOCH ? (uint32_t)epoch : 0;
+  entry.temperature = packTemperature(data.temperature[0]);
+  entry.humidity = packHumidity(data.humidity[0]);
+  entry.rain = ((data.rainValue >> HISTORY_RAIN_LEVEL_SHIFT) & HISTORY_RAIN_LEVEL_MASK) | (data.isRaining ? HISTORY_RAIN_FLAG : 0);
+  return entry;
 }
 
-// ========== Web Server Handlers ==========
-void handleRoot() {
-  if (millis() - lastWebUpdate > WEB_UPDATE_INTERVAL) {
-    readSensors();
-    server.sendHeader("Content-Type", "text/html; charset=UTF-8");
-    server.send(200, "text/html", generateHTML());
-    lastWebUpdate = millis();
-  } else {
-    server.send(429, "text/plain", "Пожалуйста, подождите...");
+int16_t packTemperature(float temperature) {
+  return isnan(temperature) ? HISTORY_NO_VALUE : (int16_t)lroundf(temperature * 100);
+}
+
+uint16_t packHumidity(float humidity) {
+  return isnan(humidity) ? HISTORY_NO_HUMIDITY : (uint16_t)lroundf(humidity * 10);
+}
+
+float unpackTemperature(int16_t temperature) {
+  return temperature == HISTORY_NO_VALUE ? NAN : temperature / 100.0f;
+}
+
+float unpackHumidity(uint16_t humidity) {
+  return humidity == HISTORY_NO_HUMIDITY ? NAN : humidity / 10.0f;
+}
+
+float historyTemperature(const HistoryRecord &entry) {
+  return unpackTemperature(entry.temperature);
+}
+
+float historyHumidity(const HistoryRecord &entry) {
+  return unpackHumidity(entry.humidity);
+}
+
+// В истории rainValue хранится с шагом 16 отсчетов
+int historyRainValue(const HistoryRecord &entry) {
+  return (entry.rain & HISTORY_RAIN_LEVEL_MASK) << HISTORY_RAIN_LEVEL_SHIFT;
+}
+
+bool historyIsRaining(const HistoryRecord &entry) {
+  return (entry.rain & HISTORY_RAIN_FLAG) != 0;
+}
+
+void formatHistoryTime(const HistoryRecord &entry, char *buffer, size_t size) {
+  formatEpochTime(entry.epoch, buffer, size);
+}
+
+// Местное время "ЧЧ:ММ ДД.ММ"; 0 - время не синхронизировано
+void formatEpochTime(uint32_t value, char *buffer, size_t size) {
+  if (value == 0) {
+    strlcpy(buffer, "--:-- --.--", size);
+    return;
   }
+  time_t epoch = value;
+  struct tm timeinfo;
+  localtime_r(&epoch, &timeinfo);
+  strftime(buffer, size, "%H:%M %d.%m", &timeinfo);
 }
 
-void handleSensorData() {
-  readSensors();
+// ========== History Recording ==========
+// Вызывается из loop(), возвращает true, если сделана запись. Записи делаются:
+//  - по таймеру HISTORY_SAVE_INTERVAL, как и раньше; устаревшие показания
+//    записываются без значений;
+//  - при смене признака дождя - сразу, текущим измерением;
+//  - когда температура или влажность канала 0 выходит из коридора swinging door
+//    (HISTORY_DOOR_*) - последним измерением, которое в коридор еще укладывалось.
+//    Такие записи - не чаще HISTORY_MIN_INTERVAL; пока запись отложена, коридор
+//    остается закрытым, и записывается все то же последнее уложившееся измерение.
+// Пока показания меняются линейно или в пределах коридора, лишних записей нет,
+// а перегибы (начало потепления, резкий рост влажности) попадают в историю точно.
+bool updateHistoryRecorder() {
+  SensorData data;
+  bool fresh = readFreshSensorSnapshot(data, SENSOR_MAX_AGE);
+  
+  if (millis() - lastHistorySave >= HISTORY_SAVE_INTERVAL) {
+    if (!fresh) {
+      for (size_t i = 0; i < SENSOR_CHANNELS; i++) {
+        data.temperature[i] = NAN;
+        data.humidity[i] = NAN;
+      }
+    }
+    saveHistory(data, time(nullptr));
+    startHistoryDoors(data);
+    historyRecorder.previous = data;
+    return true;
+  }
+  if (!fresh || data.sample == historyRecorder.previous.sample) return false;
   
-  DynamicJsonDocument doc(256);
-  doc["temp"] = sensorData.temperature;
-  doc["hum"] = sensorData.humidity;
-  doc["rain"] = sensorData.isRaining;
-  doc["rainValue"] = sensorData.rainValue;
-  doc["threshold"] = sensorData.rainThreshold;
-  doc["time"] = sensorData.lastUpdate;
+  bool saved = false;
+  if (data.isRaining != historyRecorder.raining) {
+    saveHistory(data, data.epoch);
+    startHistoryDoors(data);
+    saved = true;
+  } else {
+    bool fits = swingingDoorAdd(historyRecorder.temperature, data.temperature[0], data.sampledAt);
+    fits = swingingDoorAdd(historyRecorder.humidity, data.humidity[0], data.sampledAt) && fits;
+    if (fits) {
+      historyRecorder.lastFitting = data;
+    } else if (millis() - lastHistorySave >= HISTORY_MIN_INTERVAL) {
+      // Коридор не может закрыться на первом измерении после начала, кроме
+      // перехода к NAN и обратно - тогда записывается текущее
+      bool useFitting = historyRecorder.lastFitting.sample != historyRecorder.originSample;
+      SensorData point = useFitting ? historyRecorder.lastFitting : data;
+      saveHistory(point, point.epoch);
+      startHistoryDoors(point);
+      if (useFitting) {
+        // Новые коридоры - от записанной точки через текущее измерение
+        bool fitsNext = swingingDoorAdd(historyRecorder.temperature, data.temperature[0], data.sampledAt);
+        fitsNext = swingingDoorAdd(historyRecorder.humidity, data.humidity[0], data.sampledAt) && fitsNext;
+        if (fitsNext) historyRecorder.lastFitting = data;
+      }
+      saved = true;
+    }
+  }
+  historyRecorder.previous = data;
+  return saved;
+}
 
-  String json;
-  serializeJson(doc, json);
-  
-  server.sendHeader("Access-Control-Allow-Origin", "*");
-  server.send(200, "application/json", json);
+void startHistoryDoors(const SensorData &data) {
+  swingingDoorStart(historyRecorder.temperature, data.temperature[0], data.sampledAt);
+  swingingDoorStart(historyRecorder.humidity, data.humidity[0], data.sampledAt);
+  historyRecorder.originSample = data.sample;
+  historyRecorder.lastFitting = data;
+  historyRecorder.raining = data.isRaining;
 }
 
-void handleHistoryData() {
-  DynamicJsonDocument doc(4096);
-  JsonArray history = doc.createNestedArray("history");
-  
-  for (int i = 0; i < sensorHistory.count; i++) {
-    int idx = (sensorHistory.index - sensorHistory.count + i + HISTORY_SIZE) % HISTORY_SIZE;
-    JsonObject record = history.createNestedObject();
-    record["time"] = sensorHistory.records[idx].timestamp;
-    record["temp"] = sensorHistory.records[idx].temperature;
-    record["hum"] = sensorHistory.records[idx].humidity;
-    record["rain"] = sensorHistory.records[idx].isRaining;
+// Сколько секунд истории представляет запись: интервал до предыдущей записи,
+// но не больше периода записи по таймеру (после перерыва в работе)
+uint32_t historyRecordSpan(uint32_t previousEpoch, uint32_t epoch) {
+  uint32_t span = (HISTORY_SAVE_INTERVAL) / 1000;
+  if (previousEpoch == 0 || epoch <= previousEpoch) return span;
+  return std::min(epoch - previousEpoch, span);
+}
+
+// ========== Channel History ==========
+void channelHistoryAppend(uint32_t seq, const SensorData &data, uint32_t epoch) {
+  uint16_t pos = channelHistory.next;
+  channelHistory.epoch[pos] = epoch;
+  for (size_t i = 0; i < SENSOR_CHANNELS; i++) {
+    channelHistory.temperature[i][pos] = packTemperature(data.temperature[i]);
+    channelHistory.humidity[i][pos] = packHumidity(data.humidity[i]);
   }
-  
-  String json;
-  serializeJson(doc, json);
-  
-  server.sendHeader("Access-Control-Allow-Origin", "*");
-  server.send(200, "application/json", json);
+  channelHistory.next = (pos + 1) % HISTORY_SIZE;
+  channelHistory.count = std::min<uint16_t>(channelHistory.count + 1, HISTORY_SIZE);
+  channelHistory.headSeq = seq;
 }
 
-void handleSetTZ() {
-  if (server.hasArg("tz")) {
-    int tz = server.arg("tz").toInt();
-    if (tz >= -12 && tz <= 14) {
-      timeZoneOffset = tz;
-      configLocalTime();
-    }
+// Позиция записи seq в кольце, -1 - записи в окне нет
+int channelHistoryIndex(uint32_t seq) {
+  if (channelHistory.headSeq == 0 || seq > channelHistory.headSeq || channelHistory.headSeq - seq >= channelHistory.count) {
+    return -1;
   }
-  if (server.hasArg("rain_threshold")) {
-    sensorData.rainThreshold = server.arg("rain_threshold").toInt();
+  return (channelHistory.next + HISTORY_SIZE - 1 - (channelHistory.headSeq - seq)) % HISTORY_SIZE;
+}
+
+// Сводка по столбцу канала: порядок записей для min/max/среднего не важен,
+// поэтому занятая часть столбца проходится подряд
+template <typename T>
+StatsSummary summarizeChannelColumn(const T *column, T noValue, float scale) {
+  StatsSummary summary = {0, 0, 0, 0, NAN};
+  T minValue = 0, maxValue = 0;
+  int32_t sum = 0;
+  for (uint16_t i = 0; i < channelHistory.count; i++) {
+    if (column[i] == noValue) continue;
+    if (summary.count == 0 || column[i] < minValue) minValue = column[i];
+    if (summary.count == 0 || column[i] > maxValue) maxValue = column[i];
+    sum += column[i];
+    summary.count++;
   }
-  server.sendHeader("Location", "/");
-  server.send(303);
+  if (summary.count > 0) {
+    summary.min = minValue * scale;
+    summary.max = maxValue * scale;
+    summary.avg = sum * scale / summary.count;
+  }
+  return summary;
 }
 
-void handleCalibrate() {
-  calibrateRainSensor();
-  server.sendHeader("Location", "/");
-  server.send(303);
+// Интервал времени, который покрывает окно, в секундах
+uint32_t channelHistorySpan() {
+  if (channelHistory.count < 2) return 0;
+  uint16_t oldest = channelHistory.count == HISTORY_SIZE ? channelHistory.next : 0;
+  uint16_t newest = (channelHistory.next + HISTORY_SIZE - 1) % HISTORY_SIZE;
+  if (channelHistory.epoch[oldest] == 0 || channelHistory.epoch[newest] == 0) return 0;
+  return channelHistory.epoch[newest] - channelHistory.epoch[oldest];
 }
 
-void handleSaveWiFi() {
-  if (!validateCsrf()) {
-    server.send(403, "text/plain", "Ошибка CSRF-токена");
-    return;
+StatsSummary summarizeChannelTemperature(size_t channel) {
+  return summarizeChannelColumn(channelHistory.temperature[channel], (int16_t)HISTORY_NO_VALUE, 0.01f);
+}
+
+StatsSummary summarizeChannelHumidity(size_t channel) {
+  return summarizeChannelColumn(channelHistory.humidity[channel], (uint16_t)HISTORY_NO_HUMIDITY, 0.1f);
+}
+
+// ========== History Store ==========
+// Возвращает блок, закрытый перед этой записью (его нужно перенести во флеш), или nullptr
+const HistoryBlock *historyStoreAppend(uint32_t seq, const HistoryRecord &entry) {
+  HistoryBlock *block = &sensorHistory.blocks[sensorHistory.head];
+  const HistoryBlock *sealed = nullptr;
+  
+  // Новый блок, если в текущем может не хватить места для записи
+  if (sensorHistory.blockCount == 0 || !sensorHistory.headOpen || historyBlockFull(*block)) {
+    if (sensorHistory.blockCount > 0) {
+      if (sensorHistory.headOpen) sealed = block;
+      sensorHistory.head = (sensorHistory.head + 1) % HISTORY_BLOCK_COUNT;
+    }
+    block = &sensorHistory.blocks[sensorHistory.head];
+    if (sensorHistory.blockCount == HISTORY_BLOCK_COUNT) {
+      sensorHistory.count -= block->count;
+    } else {
+      sensorHistory.blockCount++;
+    }
+    block->firstSeq = seq;
+    block->count = 0;
+    block->bitLength = 0;
+    sensorHistory.state = {};
+    sensorHistory.headOpen = true;
   }
   
-  if (server.method() == HTTP_POST) {
-    String newSSID = server.arg("ssid");
-    String newPass = server.arg("password");
-    
-    // Проверка длины
-    if (newSSID.length() == 0 || newSSID.length() > MAX_SSID_LENGTH - 1) {
-      server.send(400, "text/plain", "Ошибка: Некорректная длина SSID");
-      return;
-    }
-    
-    if (newPass.length() > MAX_PASSWORD_LENGTH - 1) {
-      server.send(400, "text/plain", "Ошибка: Слишком длинный пароль");
+  encodeHistoryRecord(*block, sensorHistory.state, entry);
+  block->count++;
+  sensorHistory.count++;
+  return sealed;
+}
+
+// Закрытый блок из флеша становится головным как есть, без перекодирования
+void historyStoreLoad(const HistoryBlock &block) {
+  if (sensorHistory.blockCount > 0) {
+    sensorHistory.head = (sensorHistory.head + 1) % HISTORY_BLOCK_COUNT;
+  }
+  HistoryBlock &slot = sensorHistory.blocks[sensorHistory.head];
+  if (sensorHistory.blockCount == HISTORY_BLOCK_COUNT) {
+    sensorHistory.count -= slot.count;
+  } else {
+    sensorHistory.blockCount++;
+  }
+  slot = block;
+  sensorHistory.count += block.count;
+  sensorHistory.headOpen = false;
+}
+
+void historyCursorSeek(HistoryCursor &cursor, uint32_t seq) {
+  cursor.seq = std::max<uint32_t>(seq, 1);
+  cursor.block = -1;
+  cursor.inLog = false;
+  if (cursor.seq > historyHeadSeq) return;
+  
+  if (cursor.seq < historyOldestSeq()) {
+    // Закрытый блок из журнала во флеше; поврежденные блоки пропускаются
+    uint32_t count = historyLogBlockCount();
+    for (uint32_t i = count > 0 ? historyLogFindBlock(cursor.seq) : 0; i < count; i++) {
+      if (!historyLogReadBlock(i, cursor.logBlock) || cursor.logBlock.firstSeq + cursor.logBlock.count <= cursor.seq) continue;
+      cursor.inLog = true;
+      cursor.seq = std::max(cursor.seq, cursor.logBlock.firstSeq);
+      historyCursorStart(cursor, cursor.logBlock);
       return;
     }
-    
-    strlcpy(wifiSettings.ssid, newSSID.c_str(), sizeof(wifiSettings.ssid));
-    strlcpy(wifiSettings.password, newPass.c_str(), sizeof(wifiSettings.password));
-    saveWiFiSettings();
-    
-    server.send(200, "text/plain", "Настройки WiFi сохранены! Перезагрузка...");
-    shouldReboot = true;
+    cursor.seq = historyOldestSeq();
+  }
+  
+  // Блок с нужной записью, дальше декодирование с его начала
+  for (int i = 0; i < sensorHistory.blockCount; i++) {
+    int b = (sensorHistory.head - i + HISTORY_BLOCK_COUNT) % HISTORY_BLOCK_COUNT;
+    const HistoryBlock &block = sensorHistory.blocks[b];
+    if (cursor.seq < block.firstSeq) continue;
+    cursor.block = b;
+    historyCursorStart(cursor, block);
     return;
   }
-  server.send(400, "text/plain", "Ошибка: Неверный метод запроса");
 }
 
-void handleSaveOTA() {
-  if (!validateCsrf()) {
-    server.send(403, "text/plain", "Ошибка CSRF-токена");
-    return;
+// Декодирование блока с начала до записи cursor.seq
+void historyCursorStart(HistoryCursor &cursor, const HistoryBlock &block) {
+  cursor.bitPos = 0;
+  cursor.indexInBlock = 0;
+  cursor.state = {};
+  HistoryRecord skipped;
+  for (uint32_t n = block.firstSeq; n < cursor.seq; n++) {
+    decodeHistoryRecord(block, cursor.bitPos, cursor.state, skipped);
+    cursor.indexInBlock++;
+  }
+}
+
+// Следующая запись с номером меньше endSeq; номер только что прочитанной
+// записи - cursor.seq - 1. Блоки журнала, не прошедшие проверку CRC, пропускаются.
+bool historyCursorNext(HistoryCursor &cursor, HistoryRecord &entry, uint32_t endSeq) {
+  if (cursor.seq > historyHeadSeq || cursor.seq >= endSeq || cursor.seq == 0) return false;
+  
+  // Блок журнала прочитан до конца - следующий блок журнала или блоки в памяти
+  if (cursor.inLog ? cursor.indexInBlock >= cursor.logBlock.count : cursor.block < 0) {
+    historyCursorSeek(cursor, cursor.seq);
+    if (cursor.seq > historyHeadSeq || cursor.seq >= endSeq) return false;
+    if (!cursor.inLog && cursor.block < 0) return false;
   }
   
-  if (server.method() == HTTP_POST) {
-    String newUser = server.arg("ota_user");
-    String newPass = server.arg("ota_pass");
+  const HistoryBlock *block = cursor.inLog ? &cursor.logBlock : &sensorHistory.blocks[cursor.block];
+  if (!cursor.inLog && cursor.indexInBlock >= block->count) {
+    cursor.block = (cursor.block + 1) % HISTORY_BLOCK_COUNT;
+    cursor.bitPos = 0;
+    cursor.indexInBlock = 0;
+    cursor.state = {};
+    block = &sensorHistory.blocks[cursor.block];
+  }
+  decodeHistoryRecord(*block, cursor.bitPos, cursor.state, entry);
+  cursor.indexInBlock++;
+  cursor.seq++;
+  return true;
+}
+
+// Номер первой записи со временем не раньше epoch (historyHeadSeq + 1, если таких нет).
+// Записи идут по времени, поэтому поиск двоичный: по первым записям блоков в памяти,
+// если там нет - по первым записям блоков журнала во флеше, затем внутри одного блока.
+// Записи без синхронизированного времени (epoch 0) при сравнении пропускаются.
+uint32_t findHistorySeqByTime(uint32_t epoch) {
+  HistoryCursor cursor;
+  HistoryRecord entry;
+  
+  // Последний блок, первая запись которого раньше epoch
+  uint32_t startSeq = 0;
+  for (int i = 0; i < sensorHistory.blockCount; i++) {
+    int b = (sensorHistory.head - i + HISTORY_BLOCK_COUNT) % HISTORY_BLOCK_COUNT;
+    uint16_t bitPos = 0;
+    HistoryCodecState state = {};
+    decodeHistoryRecord(sensorHistory.blocks[b], bitPos, state, entry);
+    if (entry.epoch != 0 && entry.epoch < epoch) {
+      startSeq = sensorHistory.blocks[b].firstSeq;
+      break;
+    }
+  }
+  
+  if (startSeq == 0) {
+    uint32_t lo = 0, hi = historyLogBlockCount();
+    while (lo < hi) {
+      uint32_t mid = lo + (hi - lo) / 2;
+      if (historyLogEpochAt(mid) < epoch) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    startSeq = lo > 0 && historyLogReadBlock(lo - 1, cursor.logBlock) ? cursor.logBlock.firstSeq : historyFirstSeq();
+  }
+  
+  historyCursorSeek(cursor, startSeq);
+  while (historyCursorNext(cursor, entry)) {
+    if (entry.epoch >= epoch) return cursor.seq - 1;
+  }
+  return historyHeadSeq + 1;
+}
+
+// Время первой записи блока журнала для двоичного поиска; 0 - блок не читается
+// или время записи не синхронизировано
+uint32_t historyLogEpochAt(uint32_t index) {
+  HistoryBlock block;
+  if (!historyLogReadBlock(index, block)) return 0;
+  uint16_t bitPos = 0;
+  HistoryCodecState state = {};
+  HistoryRecord entry;
+  decodeHistoryRecord(block, bitPos, state, entry);
+  return entry.epoch;
+}
+
+// ========== History Log ==========
+void initHistoryLog() {
+  historyLog.partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, HISTORY_LOG_PARTITION);
+  if (historyLog.partition == nullptr) {
+    Serial.println("Журнал истории отключен: раздел " HISTORY_LOG_PARTITION " не найден");
+    return;
+  }
+  uint32_t sectors = historyLog.partition->size / HISTORY_LOG_SECTOR_SIZE;
+  if (sectors < HISTORY_LOG_JOURNAL_SECTORS + 2) {
+    historyLog.partition = nullptr;
+    return;
+  }
+  historyLog.segmentCount = sectors - HISTORY_LOG_JOURNAL_SECTORS;
+  historyLog.journalOffset = historyLog.segmentCount * HISTORY_LOG_SECTOR_SIZE;
+  
+  // Опорный сегмент - первый с корректным заголовком. Сегмент 0 может оказаться
+  // стертым, если питание пропало во время перехода на него.
+  HistoryLogHeader reference, header;
+  uint32_t base = 0;
+  if (!readHistoryLogHeader(0, reference)) {
+    base = 1;
+    if (!readHistoryLogHeader(1, reference)) base = historyLog.segmentCount;
+  }
+  
+  if (base < historyLog.segmentCount) {
+    // Номера сегментов растут от опорного до головного и обрываются после него
+    // (дальше стертые сегменты или более старый круг) - голова ищется двоичным поиском.
+    uint32_t lo = base, hi = historyLog.segmentCount - 1;
+    while (lo < hi) {
+      uint32_t mid = (lo + hi + 1) / 2;
+      if (readHistoryLogHeader(mid, header) && header.segmentSeq >= reference.segmentSeq) {
+        lo = mid;
+      } else {
+        hi = mid - 1;
+      }
+    }
+    readHistoryLogHeader(lo, header);
+    historyLog.headSegment = lo;
+    historyLog.headSegmentSeq = header.segmentSeq;
+    historyLog.endSeq = header.firstSeq;
+    
+    // Самый старый сегмент идет сразу за головным (с учетом возможного стертого)
+    historyLog.oldestSegment = 0;
+    for (uint32_t step = 1; step <= 2; step++) {
+      uint32_t segment = (lo + step) % historyLog.segmentCount;
+      if (segment != lo && readHistoryLogHeader(segment, header) && header.segmentSeq < historyLog.headSegmentSeq) {
+        historyLog.oldestSegment = segment;
+        break;
+      }
+    }
+    historyLog.usedSegments = (lo + historyLog.segmentCount - historyLog.oldestSegment) % historyLog.segmentCount + 1;
+    readHistoryLogHeader(historyLog.oldestSegment, header);
+    historyLog.firstSeq = header.firstSeq;
+    
+    // Блоки внутри сегмента идут подряд - первая свободная позиция тоже ищется двоичным поиском
+    lo = 0;
+    hi = HISTORY_LOG_BLOCKS;
+    while (lo < hi) {
+      uint32_t mid = (lo + hi) / 2;
+      if (historyLogSlotUsed(historyLog.headSegment, mid)) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+    
+    // Недописанный при сбое питания блок занимает позицию, но не проходит проверку CRC
+    HistoryLogBlock logBlock;
+    while (lo < HISTORY_LOG_BLOCKS) {
+      esp_partition_read(historyLog.partition, historyLog.headSegment * HISTORY_LOG_SECTOR_SIZE + sizeof(HistoryLogHeader) + lo * sizeof(HistoryLogBlock), &logBlock, sizeof(logBlock));
+      const uint8_t *bytes = (const uint8_t *)&logBlock;
+      if (std::all_of(bytes, bytes + sizeof(logBlock), [](uint8_t b) { return b == 0xFF; })) break;
+      lo++;
+    }
+    historyLog.nextBlock = lo;
+    
+    // Конец закрытых блоков - по последнему целому блоку головного сегмента
+    uint32_t segmentStart = (historyLog.usedSegments - 1) * HISTORY_LOG_BLOCKS;
+    for (uint32_t i = historyLogBlockCount(); i > segmentStart; i--) {
+      if (historyLogReadBlock(i - 1, logBlock.block)) {
+        historyLog.endSeq = logBlock.block.firstSeq + logBlock.block.count;
+        break;
+      }
+    }
+  }
+  
+  // Записи открытого блока: позиция i журнала записей - запись journalSeq + i.
+  // Если все они уже есть в закрытых блоках (питание пропало между записью
+  // блока и стиранием журнала) или журнал начат с поврежденной записи, он стирается.
+  // Журнал, начатый позже конца блоков (последний блок поврежден), сохраняется -
+  // в истории остается пропуск.
+  HistoryLogEntry entry;
+  uint32_t slot = 0;
+  for (; slot < HISTORY_LOG_JOURNAL_SLOTS; slot++) {
+    esp_partition_read(historyLog.partition, historyLog.journalOffset + slot * sizeof(HistoryLogEntry), &entry, sizeof(entry));
+    const uint8_t *bytes = (const uint8_t *)&entry;
+    if (std::all_of(bytes, bytes + sizeof(entry), [](uint8_t b) { return b == 0xFF; })) break;
+    bool valid = entry.crc == esp_rom_crc16_le(0, (const uint8_t *)&entry, offsetof(HistoryLogEntry, crc));
+    if (slot == 0) {
+      if (!valid) break;
+      historyLog.journalSeq = entry.seq;
+    } else if (valid && entry.seq != historyLog.journalSeq + slot) {
+      break;
+    }
+  }
+  if (slot == 0 || historyLog.journalSeq + slot <= historyLog.endSeq) {
+    esp_partition_erase_range(historyLog.partition, historyLog.journalOffset, HISTORY_LOG_JOURNAL_SECTORS * HISTORY_LOG_SECTOR_SIZE);
+    historyLog.journalSeq = 0;
+    slot = 0;
+  }
+  historyHeadSeq = slot > 0 ? historyLog.journalSeq + slot - 1 : historyLog.endSeq - 1;
+  
+  Serial.printf("Журнал истории: %lu сегментов, %lu блоков, записи %lu..%lu\n", (unsigned long)historyLog.usedSegments,
+                (unsigned long)historyLogBlockCount(), (unsigned long)historyFirstSeq(), (unsigned long)historyHeadSeq);
+}
+
+bool readHistoryLogHeader(uint32_t segment, HistoryLogHeader &header) {
+  if (esp_partition_read(historyLog.partition, segment * HISTORY_LOG_SECTOR_SIZE, &header, sizeof(header)) != ESP_OK) {
+    return false;
+  }
+  return header.magic == HISTORY_LOG_MAGIC &&
+         header.crc == esp_rom_crc32_le(0, (const uint8_t *)&header, offsetof(HistoryLogHeader, crc));
+}
+
+bool historyLogSlotUsed(uint32_t segment, uint32_t slot) {
+  uint32_t seq = 0xFFFFFFFF;
+  esp_partition_read(historyLog.partition, segment * HISTORY_LOG_SECTOR_SIZE + sizeof(HistoryLogHeader) + slot * sizeof(HistoryLogBlock), &seq, sizeof(seq));
+  return seq != 0xFFFFFFFF;
+}
+
+// Блоки журнала нумеруются с самого старого; все сегменты, кроме головного, заполнены
+uint32_t historyLogBlockCount() {
+  if (historyLog.partition == nullptr || historyLog.usedSegments == 0) return 0;
+  return (historyLog.usedSegments - 1) * HISTORY_LOG_BLOCKS + historyLog.nextBlock;
+}
+
+uint32_t historyLogBlockOffset(uint32_t index) {
+  uint32_t segment = (historyLog.oldestSegment + index / HISTORY_LOG_BLOCKS) % historyLog.segmentCount;
+  return segment * HISTORY_LOG_SECTOR_SIZE + sizeof(HistoryLogHeader) + index % HISTORY_LOG_BLOCKS * sizeof(HistoryLogBlock);
+}
+
+bool historyLogReadBlock(uint32_t index, HistoryBlock &block) {
+  if (index >= historyLogBlockCount()) return false;
+  uint32_t offset = historyLogBlockOffset(index);
+  uint32_t crc;
+  if (esp_partition_read(historyLog.partition, offset, &block, sizeof(block)) != ESP_OK ||
+      esp_partition_read(historyLog.partition, offset + offsetof(HistoryLogBlock, crc), &crc, sizeof(crc)) != ESP_OK) {
+    return false;
+  }
+  return crc == esp_rom_crc32_le(0, (const uint8_t *)&block, sizeof(block)) && block.count > 0 &&
+         block.bitLength <= HISTORY_BLOCK_SIZE * 8;
+}
+
+// Последний блок журнала, первая запись которого не позже seq: сегмент - двоичным
+// поиском по заголовкам, блок внутри сегмента - по первым номерам блоков
+uint32_t historyLogFindBlock(uint32_t seq) {
+  HistoryLogHeader header;
+  uint32_t lo = 0, hi = historyLog.usedSegments - 1;
+  while (lo < hi) {
+    uint32_t mid = (lo + hi + 1) / 2;
+    if (readHistoryLogHeader((historyLog.oldestSegment + mid) % historyLog.segmentCount, header) && header.firstSeq <= seq) {
+      lo = mid;
+    } else {
+      hi = mid - 1;
+    }
+  }
+  
+  uint32_t index = lo * HISTORY_LOG_BLOCKS;
+  uint32_t end = std::min<uint32_t>(index + HISTORY_LOG_BLOCKS, historyLogBlockCount());
+  for (uint32_t i = index + 1; i < end; i++) {
+    uint32_t firstSeq = 0xFFFFFFFF;
+    esp_partition_read(historyLog.partition, historyLogBlockOffset(i), &firstSeq, sizeof(firstSeq));
+    if (firstSeq > seq) break;
+    index = i;
+  }
+  return index;
+}
+
+// Запись открытого блока из журнала записей
+bool historyLogRead(uint32_t seq, HistoryRecord &entry) {
+  if (historyLog.partition == nullptr || historyLog.journalSeq == 0 || seq < historyLog.journalSeq) return false;
+  uint32_t slot = seq - historyLog.journalSeq;
+  if (slot >= HISTORY_LOG_JOURNAL_SLOTS) return false;
+  
+  HistoryLogEntry logEntry;
+  esp_partition_read(historyLog.partition, historyLog.journalOffset + slot * sizeof(HistoryLogEntry), &logEntry, sizeof(logEntry));
+  if (logEntry.seq != seq || logEntry.crc != esp_rom_crc16_le(0, (const uint8_t *)&logEntry, offsetof(HistoryLogEntry, crc))) {
+    return false;
+  }
+  entry = logEntry.record;
+  return true;
+}
+
+void historyLogAppend(uint32_t seq, const HistoryRecord &entry, const HistoryBlock *sealed) {
+  if (historyLog.partition == nullptr) return;
+  
+  // Закрытый блок переносится в сегменты целиком, его записи в журнале больше не нужны
+  if (sealed != nullptr) {
+    historyLogWriteBlock(*sealed);
+    esp_partition_erase_range(historyLog.partition, historyLog.journalOffset, HISTORY_LOG_JOURNAL_SECTORS * HISTORY_LOG_SECTOR_SIZE);
+    historyLog.journalSeq = 0;
+  }
+  if (historyLog.journalSeq == 0) historyLog.journalSeq = seq;
+  
+  // Позиция в журнале однозначно задается номером: seq = journalSeq + позиция
+  uint32_t slot = seq - historyLog.journalSeq;
+  if (slot >= HISTORY_LOG_JOURNAL_SLOTS) return;
+  HistoryLogEntry logEntry;
+  logEntry.seq = seq;
+  logEntry.record = entry;
+  logEntry.crc = esp_rom_crc16_le(0, (const uint8_t *)&logEntry, offsetof(HistoryLogEntry, crc));
+  esp_partition_write(historyLog.partition, historyLog.journalOffset + slot * sizeof(HistoryLogEntry), &logEntry, sizeof(logEntry));
+}
+
+void historyLogWriteBlock(const HistoryBlock &block) {
+  // Переход к следующему сегменту: стирание сектора и запись заголовка
+  if (historyLog.usedSegments == 0 || historyLog.nextBlock >= HISTORY_LOG_BLOCKS) {
+    uint32_t segment = historyLog.usedSegments == 0 ? 0 : (historyLog.headSegment + 1) % historyLog.segmentCount;
+    esp_partition_erase_range(historyLog.partition, segment * HISTORY_LOG_SECTOR_SIZE, HISTORY_LOG_SECTOR_SIZE);
+    
+    HistoryLogHeader header;
+    header.magic = HISTORY_LOG_MAGIC;
+    header.segmentSeq = historyLog.headSegmentSeq + 1;
+    header.firstSeq = block.firstSeq;
+    header.crc = esp_rom_crc32_le(0, (const uint8_t *)&header, offsetof(HistoryLogHeader, crc));
+    esp_partition_write(historyLog.partition, segment * HISTORY_LOG_SECTOR_SIZE, &header, sizeof(header));
+    
+    if (historyLog.usedSegments == historyLog.segmentCount) {
+      // Перезаписан самый старый сегмент
+      historyLog.oldestSegment = (historyLog.oldestSegment + 1) % historyLog.segmentCount;
+      HistoryLogHeader oldest;
+      if (readHistoryLogHeader(historyLog.oldestSegment, oldest)) historyLog.firstSeq = oldest.firstSeq;
+    } else {
+      if (historyLog.usedSegments == 0) historyLog.firstSeq = block.firstSeq;
+      historyLog.usedSegments++;
+    }
+    historyLog.headSegment = segment;
+    historyLog.headSegmentSeq = header.segmentSeq;
+    historyLog.nextBlock = 0;
+  }
+  
+  uint32_t offset = historyLogBlockOffset(historyLogBlockCount());
+  uint32_t crc = esp_rom_crc32_le(0, (const uint8_t *)&block, sizeof(block));
+  esp_partition_write(historyLog.partition, offset, &block, sizeof(block));
+  esp_partition_write(historyLog.partition, offset + offsetof(HistoryLogBlock, crc), &crc, sizeof(crc));
+  historyLog.nextBlock++;
+  historyLog.endSeq = block.firstSeq + block.count;
+}
+
+// Последние закрытые блоки, идущие подряд до записей журнала, копируются в память
+// как есть; записи открытого блока кодируются заново из журнала записей.
+void restoreHistoryFromLog() {
+  if (historyLog.partition == nullptr || historyHeadSeq == 0) return;
+  
+  uint32_t journalStart = std::max(historyLog.journalSeq, historyLog.endSeq);
+  uint32_t count = historyLogBlockCount();
+  uint32_t first = count, expected = journalStart;
+  HistoryBlock block;
+  while (first > 0 && count - first < HISTORY_BLOCK_COUNT - 1) {
+    // Недописанный последний блок пропускается, дальше блоки должны идти подряд
+    bool valid = historyLogReadBlock(first - 1, block);
+    if (valid ? block.firstSeq + block.count != expected : expected != journalStart) break;
+    if (valid) expected = block.firstSeq;
+    first--;
+  }
+  for (uint32_t i = first; i < count; i++) {
+    if (historyLogReadBlock(i, block)) historyStoreLoad(block);
+  }
+  
+  for (uint32_t seq = journalStart; seq <= historyHeadSeq; seq++) {
+    HistoryRecord entry;
+    if (!historyLogRead(seq, entry)) {
+      // Поврежденная запись заменяется пустой, чтобы номера в буфере шли подряд
+      entry = {0, HISTORY_NO_VALUE, HISTORY_NO_HUMIDITY, 0};
+    }
+    // Блок, закрытый при перекодировании, сразу переносится в сегменты
+    const HistoryBlock *sealed = historyStoreAppend(seq, entry);
+    if (sealed != nullptr) historyLogWriteBlock(*sealed);
+  }
+}
+
+// ========== History Rollups ==========
+// Каждая запись сразу добавляется в текущий час и текущие сутки, поэтому
+// запросы за недели отдаются из готовых агрегатов без просмотра записей.
+void addToRollup(RollupTier &tier, const HistoryRecord &entry, uint32_t span) {
+  if (entry.epoch == 0) return;
+  
+  // Границы считаются по местному времени, чтобы сутки начинались в полночь
+  int32_t offset = timeZoneOffset * 3600;
+  uint32_t start = entry.epoch - (uint32_t)((int64_t)entry.epoch + offset) % tier.period;
+  
+  RollupBucket *bucket = tier.count > 0 ? &tier.buckets[(tier.index - 1 + tier.capacity) % tier.capacity] : nullptr;
+  if (bucket == nullptr || start > bucket->start) {
+    bucket = &tier.buckets[tier.index];
+    resetRollupBucket(*bucket, start);
+    tier.index = (tier.index + 1) % tier.capacity;
+    if (tier.count < tier.capacity) tier.count++;
+  }
+  // Если часы ушли назад, запись учитывается в последнем интервале
+  addToRollupBucket(*bucket, entry, span);
+}
+
+void resetRollupBucket(RollupBucket &bucket, uint32_t start) {
+  bucket = {start, INT16_MAX, INT16_MIN, 0, 0, UINT16_MAX, 0, 0, 0, 0};
+}
+
+// span - сколько секунд представляет запись (historyRecordSpan)
+void addToRollupBucket(RollupBucket &bucket, const HistoryRecord &entry, uint32_t span) {
+  if (entry.temperature != HISTORY_NO_VALUE) {
+    bucket.tempMin = std::min(bucket.tempMin, entry.temperature);
+    bucket.tempMax = std::max(bucket.tempMax, entry.temperature);
+    bucket.tempSum += entry.temperature;
+    bucket.tempCount++;
+  }
+  if (entry.humidity != HISTORY_NO_HUMIDITY) {
+    bucket.humMin = std::min(bucket.humMin, entry.humidity);
+    bucket.humMax = std::max(bucket.humMax, entry.humidity);
+    bucket.humSum += entry.humidity;
+    bucket.humCount++;
+  }
+  if (historyIsRaining(entry)) bucket.rainSeconds += span;
+}
+
+// Записи поступают по порядку: при запуске из журнала, дальше из saveHistory()
+void addToRollups(const HistoryRecord &entry) {
+  static uint32_t previousEpoch = 0;
+  if (entry.epoch == 0) return;
+  uint32_t span = historyRecordSpan(previousEpoch, entry.epoch);
+  previousEpoch = entry.epoch;
+  addToRollup(hourlyRollup, entry, span);
+  addToRollup(dailyRollup, entry, span);
+}
+
+// Агрегаты не хранятся во флеше: при запуске они пересчитываются из журнала
+// за период, который помещается в суточный буфер. Записи идут с переменным
+// шагом, поэтому начало периода ищется по времени последней записи.
+void replayRollups() {
+  if (historyHeadSeq == 0) return;
+  
+  HistoryCursor cursor;
+  HistoryRecord entry;
+  historyCursorSeek(cursor, historyHeadSeq);
+  uint32_t newest = historyCursorNext(cursor, entry) ? entry.epoch : 0;
+  uint32_t depth = ROLLUP_DAILY_SIZE * 86400;
+  uint32_t first = newest > depth ? findHistorySeqByTime(newest - depth) : historyFirstSeq();
+  historyCursorSeek(cursor, first);
+  while (historyCursorNext(cursor, entry)) {
+    addToRollups(entry);
+  }
+  Serial.printf("Агрегаты истории: %u ч, %u сут\n", hourlyRollup.count, dailyRollup.count);
+}
+
+// i-й по старшинству интервал
+const RollupBucket &rollupBucket(const RollupTier &tier, int i) {
+  return tier.buckets[(tier.index - tier.count + i + tier.capacity) % tier.capacity];
+}
+
+size_t serializeRollupBucket(const RollupBucket &bucket, char *buffer, size_t size) {
+  StaticJsonDocument<256> doc;
+  doc["t"] = bucket.start;
+  if (bucket.tempCount > 0) {
+    doc["temp"] = bucket.tempSum / (float)bucket.tempCount / 100.0f;
+    doc["tMin"] = bucket.tempMin / 100.0f;
+    doc["tMax"] = bucket.tempMax / 100.0f;
+  }
+  if (bucket.humCount > 0) {
+    doc["hum"] = bucket.humSum / (float)bucket.humCount / 10.0f;
+    doc["hMin"] = bucket.humMin / 10.0f;
+    doc["hMax"] = bucket.humMax / 10.0f;
+  }
+  doc["rain"] = (bucket.rainSeconds + 30) / 60;
+  doc["n"] = std::max(bucket.tempCount, bucket.humCount);
+  return serializeJson(doc, buffer, size);
+}
+
+// /history-range?from=&to=   (Unix-время; по умолчанию последние сутки)
+// Разрешение выбирается по длине периода: исходные записи из памяти,
+// если их хватает, иначе самое подробное из часов и суток, при котором
+// период покрыт и точек не больше ROLLUP_MAX_POINTS.
+// Ответ: {"resolution":"raw|hour|day","step":секунды,"points":[{t,temp,hum,rain,...}]},
+// rain - минуты с дождем, у агрегатов есть еще tMin/tMax/hMin/hMax и n. Исходные
+// записи идут с переменным шагом, для них step - наибольший (HISTORY_SAVE_INTERVAL).
+void handleHistoryRange() {
+  server.sendHeader("Access-Control-Allow-Origin", "*");
+  
+  uint32_t to = server.hasArg("to") ? strtoul(server.arg("to").c_str(), nullptr, 10) : (uint32_t)time(nullptr);
+  uint32_t from = server.hasArg("from") ? strtoul(server.arg("from").c_str(), nullptr, 10) : (to > 86400 ? to - 86400 : 0);
+  if (from >= to) {
+    server.send(400, "text/plain", "Ошибка: from должен быть меньше to");
+    return;
+  }
+  uint32_t span = to - from;
+  
+  // Самая старая запись с известным временем в памяти
+  uint32_t rawOldest = 0;
+  HistoryCursor cursor;
+  HistoryRecord entry;
+  historyCursorSeek(cursor, historyOldestSeq());
+  while (rawOldest == 0 && historyCursorNext(cursor, entry)) {
+    rawOldest = entry.epoch;
+  }
+  
+  const RollupTier *tier = &dailyRollup;
+  // Записи идут с переменным шагом, поэтому их число в [from, to] считается по номерам
+  if (rawOldest != 0 && rawOldest <= from &&
+      findHistorySeqByTime(to + 1) - findHistorySeqByTime(from) <= ROLLUP_MAX_POINTS) {
+    tier = nullptr;
+  } else if (hourlyRollup.count > 0 && rollupBucket(hourlyRollup, 0).start <= from && span / hourlyRollup.period <= ROLLUP_MAX_POINTS) {
+    tier = &hourlyRollup;
+  }
+  
+  // Журнал и сводки хранят только канал 0, его имя передается в ответе
+  char prefix[128];
+  snprintf(prefix, sizeof(prefix), "{\"channel\":\"%s\",\"resolution\":\"%s\",\"step\":%lu,\"points\":[",
+           channelNames[0], tier ? tier->name : "raw", tier ? (unsigned long)tier->period : (unsigned long)((HISTORY_SAVE_INTERVAL) / 1000));
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "application/json", prefix);
+  
+  char pointJson[160];
+  bool firstPoint = true;
+  int points = 0;
+  if (tier == nullptr) {
+    uint32_t previousEpoch = 0;
+    historyCursorSeek(cursor, historyOldestSeq());
+    while (historyCursorNext(cursor, entry)) {
+      uint32_t recordSpan = historyRecordSpan(previousEpoch, entry.epoch);
+      if (entry.epoch != 0) previousEpoch = entry.epoch;
+      if (entry.epoch < from || entry.epoch > to) continue;
+      StaticJsonDocument<128> doc;
+      doc["t"] = entry.epoch;
+      doc["temp"] = historyTemperature(entry);
+      doc["hum"] = historyHumidity(entry);
+      doc["rain"] = historyIsRaining(entry) ? (recordSpan + 30) / 60 : 0;
+      char *out = pointJson;
+      if (!firstPoint) *out++ = ',';
+      size_t length = serializeJson(doc, out, sizeof(pointJson) - 1);
+      server.sendContent(pointJson, length + (out - pointJson));
+      firstPoint = false;
+    }
+  } else {
+    for (int i = 0; i < tier->count && points < ROLLUP_MAX_POINTS; i++) {
+      const RollupBucket &bucket = rollupBucket(*tier, i);
+      if (bucket.start + tier->period <= from || bucket.start > to) continue;
+      char *out = pointJson;
+      if (!firstPoint) *out++ = ',';
+      size_t length = serializeRollupBucket(bucket, out, sizeof(pointJson) - 1);
+      server.sendContent(pointJson, length + (out - pointJson));
+      firstPoint = false;
+      points++;
+    }
+  }
+  
+  server.sendContent("]}");
+  server.sendContent("");
+}
+
+// /history?from=&to=&step=   (Unix-время и шаг в секундах)
+// Агрегаты за интервалы по step секунд, считаются на лету из записей периода.
+// Начало периода находится двоичным поиском, дальше записи читаются подряд.
+// Без step шаг подбирается так, чтобы точек было не больше ROLLUP_MAX_POINTS,
+// и в любом случае не больше HISTORY_QUERY_MAX_LIMIT. Пустые интервалы пропускаются.
+// Ответ: {"from":..,"to":..,"step":..,"points":[{t,temp,tMin,tMax,hum,hMin,hMax,rain,n}]}
+void handleHistoryQuery() {
+  server.sendHeader("Access-Control-Allow-Origin", "*");
+  
+  uint32_t to = server.hasArg("to") ? strtoul(server.arg("to").c_str(), nullptr, 10) : (uint32_t)time(nullptr);
+  uint32_t from = server.hasArg("from") ? strtoul(server.arg("from").c_str(), nullptr, 10) : (to > 86400 ? to - 86400 : 0);
+  if (from >= to) {
+    server.send(400, "text/plain", "Ошибка: from должен быть меньше to");
+    return;
+  }
+  uint32_t span = to - from;
+  uint32_t step = server.hasArg("step") ? strtoul(server.arg("step").c_str(), nullptr, 10)
+                                        : std::max<uint32_t>((HISTORY_SAVE_INTERVAL) / 1000, span / ROLLUP_MAX_POINTS + 1);
+  step = std::max<uint32_t>(step, span / HISTORY_QUERY_MAX_LIMIT + 1);
+  
+  char prefix[96];
+  snprintf(prefix, sizeof(prefix), "{\"from\":%lu,\"to\":%lu,\"step\":%lu,\"points\":[",
+           (unsigned long)from, (unsigned long)to, (unsigned long)step);
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "application/json", prefix);
+  
+  char pointJson[160];
+  bool firstPoint = true;
+  RollupBucket bucket;
+  bool bucketOpen = false;
+  uint32_t previousEpoch = 0;
+  
+  HistoryCursor cursor;
+  HistoryRecord entry;
+  historyCursorSeek(cursor, findHistorySeqByTime(from));
+  while (true) {
+    bool hasEntry = historyCursorNext(cursor, entry);
+    if (hasEntry && (entry.epoch == 0 || entry.epoch < from)) continue;
+    uint32_t recordSpan = hasEntry ? historyRecordSpan(previousEpoch, entry.epoch) : 0;
+    if (hasEntry) previousEpoch = entry.epoch;
+    
+    bool done = !hasEntry || entry.epoch > to;
+    uint32_t start = done ? 0 : from + (entry.epoch - from) / step * step;
+    if (bucketOpen && (done || start != bucket.start)) {
+      char *out = pointJson;
+      if (!firstPoint) *out++ = ',';
+      size_t length = serializeRollupBucket(bucket, out, sizeof(pointJson) - 1);
+      server.sendContent(pointJson, length + (out - pointJson));
+      firstPoint = false;
+      bucketOpen = false;
+    }
+    if (done) break;
+    
+    if (!bucketOpen) {
+      resetRollupBucket(bucket, start);
+      bucketOpen = true;
+    }
+    addToRollupBucket(bucket, entry, recordSpan);
+  }
+  
+  server.sendContent("]}");
+  server.sendContent("");
+}
+
+// /chart-data?points=N[&from=&to=]   (по умолчанию - все записи в памяти)
+// Прореживание Largest-Triangle-Three-Buckets: первая и последняя записи
+// сохраняются, остальные делятся на N - 2 корзины по номерам, и из каждой
+// берется запись с наибольшей площадью треугольника с предыдущей выбранной
+// точкой и средним следующей корзины. Площади по температуре и влажности
+// складываются, чтобы обе линии графика строились по одним точкам.
+// Курсор один и декодирует каждую запись один раз: кандидаты текущей корзины
+// ждут в chartBuckets, пока читается следующая корзина и считается ее среднее.
+// Точки сразу отправляются.
+// Формат записей - как в /history-data.
+void handleChartData() {
+  server.sendHeader("Access-Control-Allow-Origin", "*");
+  if (handleNotModified(makeETag('c', historyHeadSeq, historyTimeVersion), "no-cache")) return;
+  
+  uint32_t points = server.hasArg("points") ? constrain((int)server.arg("points").toInt(), 3, HISTORY_QUERY_MAX_LIMIT) : ROLLUP_MAX_POINTS;
+  uint32_t start = server.hasArg("from") ? findHistorySeqByTime(strtoul(server.arg("from").c_str(), nullptr, 10)) : historyOldestSeq();
+  uint32_t end = server.hasArg("to") ? findHistorySeqByTime(strtoul(server.arg("to").c_str(), nullptr, 10) + 1) - 1 : historyHeadSeq;
+  
+  char prefix[48];
+  snprintf(prefix, sizeof(prefix), "{\"head\":%lu,\"points\":[", (unsigned long)historyHeadSeq);
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "application/json", prefix);
+  
+  char recordJson[HISTORY_RECORD_JSON_SIZE + 1];
+  bool firstRecord = true;
+  auto emit = [&](const HistoryRecord &entry, uint32_t seq) {
+    char *out = recordJson;
+    if (!firstRecord) *out++ = ',';
+    size_t length = serializeHistoryRecord(entry, seq, out, HISTORY_RECORD_JSON_SIZE);
+    server.sendContent(recordJson, length + (out - recordJson));
+    firstRecord = false;
+  };
+  
+  HistoryCursor cursor;
+  HistoryRecord entry;
+  historyCursorSeek(cursor, start);
+  
+  if (start == 0 || start > end) {
+    // пустой период
+  } else if (end - start + 1 <= points) {
+    while (historyCursorNext(cursor, entry, end + 1)) {
+      emit(entry, cursor.seq - 1);
+    }
+  } else {
+    // Границы корзин по номерам записей между первой и последней
+    uint32_t inner = end - start - 1;
+    uint32_t buckets = points - 2;
+    auto bucketStart = [&](uint32_t i) { return start + 1 + (uint32_t)((uint64_t)inner * i / buckets); };
+    
+    // Кандидатом становится каждая stride-я запись корзины, чтобы корзина
+    // поместилась в буфер; в среднее идут все записи
+    uint32_t maxBucket = (inner + buckets - 1) / buckets;
+    uint32_t stride = (maxBucket + CHART_BUCKET_CAPACITY - 1) / CHART_BUCKET_CAPACITY;
+    
+    HistoryRecord selected;
+    uint32_t selectedSeq = 0;
+    if (historyCursorNext(cursor, selected, start + 1)) {
+      selectedSeq = start;
+      emit(selected, selectedSeq);
+    }
+    
+    HistoryRecord last;
+    bool hasLast = false;
+    for (uint32_t i = 0; i <= buckets; i++) {
+      // Корзина i (после последней - сама последняя запись): кандидаты и среднее
+      HistoryRecord *candidates = chartBuckets.records[i % 2];
+      uint32_t *candidateSeqs = chartBuckets.seqs[i % 2];
+      uint16_t count = 0;
+      double epochSum = 0, tempSum = 0, humSum = 0;
+      uint32_t epochCount = 0, tempCount = 0, humCount = 0;
+      uint32_t bucketEnd = i < buckets ? bucketStart(i + 1) : end + 1;
+      for (uint32_t k = 0; historyCursorNext(cursor, entry, bucketEnd); k++) {
+        if (i == buckets) {
+          last = entry;
+          hasLast = true;
+        }
+        if (entry.epoch == 0) continue;
+        epochSum += entry.epoch;
+        epochCount++;
+        if (entry.temperature != HISTORY_NO_VALUE) {
+          tempSum += historyTemperature(entry);
+          tempCount++;
+        }
+        if (entry.humidity != HISTORY_NO_HUMIDITY) {
+          humSum += historyHumidity(entry);
+          humCount++;
+        }
+        if (k % stride == 0 && count < CHART_BUCKET_CAPACITY) {
+          candidates[count] = entry;
+          candidateSeqs[count] = cursor.seq - 1;
+          count++;
+        }
+      }
+      chartBuckets.count[i % 2] = count;
+      if (i == 0) continue;
+      uint32_t avgEpoch = epochCount ? (uint32_t)(epochSum / epochCount) : 0;
+      float avgTemp = tempCount ? tempSum / tempCount : NAN;
+      float avgHum = humCount ? humSum / humCount : NAN;
+      
+      // Запись предыдущей корзины с наибольшей площадью треугольника
+      const HistoryRecord *previous = chartBuckets.records[(i - 1) % 2];
+      int best = -1;
+      double bestArea = -1;
+      for (int n = 0; n < chartBuckets.count[(i - 1) % 2]; n++) {
+        double area = selectedSeq && avgEpoch ? triangleArea(selected, previous[n], avgEpoch, avgTemp, avgHum) : 0;
+        if (area > bestArea) {
+          best = n;
+          bestArea = area;
+        }
+      }
+      if (best >= 0) {
+        selected = previous[best];
+        selectedSeq = chartBuckets.seqs[(i - 1) % 2][best];
+        emit(selected, selectedSeq);
+      }
+    }
+    
+    if (hasLast) {
+      emit(last, end);
+    }
+  }
+  
+  server.sendContent("]}");
+  server.sendContent("");
+}
+
+// Удвоенная площадь треугольника a-b-c по времени (часы) и значению,
+// суммированная по температуре и влажности; нет данных - слагаемое пропускается
+double triangleArea(const HistoryRecord &a, const HistoryRecord &b, uint32_t cEpoch, float cTemp, float cHum) {
+  double bx = ((double)b.epoch - a.epoch) / 3600.0;
+  double cx = ((double)cEpoch - a.epoch) / 3600.0;
+  double area = 0;
+  
+  float aTemp = historyTemperature(a), bTemp = historyTemperature(b);
+  if (!isnan(aTemp) && !isnan(bTemp) && !isnan(cTemp)) {
+    area += fabs(bx * (cTemp - aTemp) - cx * (bTemp - aTemp));
+  }
+  float aHum = historyHumidity(a), bHum = historyHumidity(b);
+  if (!isnan(aHum) && !isnan(bHum) && !isnan(cHum)) {
+    area += fabs(bx * (cHum - aHum) - cx * (bHum - aHum));
+  }
+  return area;
+}
+
+// ========== Rolling Statistics ==========
+// Добавление записи и вытеснение устаревших - амортизированно O(1) на окно,
+// запросы только читают готовые значения.
+void addToStats(const HistoryRecord &entry) {
+  if (entry.epoch == 0) return;
+  if (statsSampleCount == 0) statsBaseEpoch = entry.epoch;
+  
+  uint32_t n = statsSampleCount;
+  uint16_t pos = n % STATS_CAPACITY;
+  int64_t t = (int64_t)entry.epoch - statsBaseEpoch;
+  
+  for (StatsWindow &window : statsWindows) {
+    // Место под новую запись должно освободиться, даже если время не продвинулось
+    while (window.tail < n && n - window.tail >= window.capacity) {
+      const StatsSample &old = statsSamples[window.tail % STATS_CAPACITY];
+      int64_t oldT = (int64_t)old.epoch - statsBaseEpoch;
+      if (old.temperature != HISTORY_NO_VALUE) statsSeriesRemove(window.temperature, window.capacity, window.tail % STATS_CAPACITY, old.temperature, oldT);
+      if (old.humidity != HISTORY_NO_HUMIDITY) statsSeriesRemove(window.humidity, window.capacity, window.tail % STATS_CAPACITY, old.humidity, oldT);
+      window.tail++;
+    }
+  }
+  
+  statsSamples[pos] = {entry.epoch, entry.temperature, entry.humidity};
+  statsSampleCount++;
+  
+  for (StatsWindow &window : statsWindows) {
+    if (entry.temperature != HISTORY_NO_VALUE) {
+      statsSeriesAdd(window.temperature, window.capacity, pos, entry.temperature, t, true);
+    }
+    if (entry.humidity != HISTORY_NO_HUMIDITY) {
+      statsSeriesAdd(window.humidity, window.capacity, pos, entry.humidity, t, false);
+    }
+    
+    // Вытеснение записей старше окна
+    while (window.tail < n && statsSamples[window.tail % STATS_CAPACITY].epoch + window.span <= entry.epoch) {
+      const StatsSample &old = statsSamples[window.tail % STATS_CAPACITY];
+      int64_t oldT = (int64_t)old.epoch - statsBaseEpoch;
+      if (old.temperature != HISTORY_NO_VALUE) statsSeriesRemove(window.temperature, window.capacity, window.tail % STATS_CAPACITY, old.temperature, oldT);
+      if (old.humidity != HISTORY_NO_HUMIDITY) statsSeriesRemove(window.humidity, window.capacity, window.tail % STATS_CAPACITY, old.humidity, oldT);
+      window.tail++;
+    }
+  }
+}
+
+int32_t statsValue(const StatsSample &sample, bool temperature) {
+  return temperature ? sample.temperature : sample.humidity;
+}
+
+void statsSeriesAdd(StatsSeries &series, uint16_t capacity, uint16_t pos, int32_t value, int64_t t, bool temperature) {
+  // С конца очереди убираются значения, которые уже не станут минимумом (максимумом)
+  MonotonicQueue &minQueue = series.minQueue;
+  while (minQueue.count > 0 &&
+         statsValue(statsSamples[minQueue.items[(minQueue.head + minQueue.count - 1) % capacity]], temperature) >= value) {
+    minQueue.count--;
+  }
+  minQueue.items[(minQueue.head + minQueue.count++) % capacity] = pos;
+  
+  MonotonicQueue &maxQueue = series.maxQueue;
+  while (maxQueue.count > 0 &&
+         statsValue(statsSamples[maxQueue.items[(maxQueue.head + maxQueue.count - 1) % capacity]], temperature) <= value) {
+    maxQueue.count--;
+  }
+  maxQueue.items[(maxQueue.head + maxQueue.count++) % capacity] = pos;
+  
+  series.count++;
+  series.sumX += value;
+  series.sumT += t;
+  series.sumTX += t * value;
+  series.sumTT += t * t;
+}
+
+void statsSeriesRemove(StatsSeries &series, uint16_t capacity, uint16_t pos, int32_t value, int64_t t) {
+  // Уходящая запись может стоять только в начале очередей
+  if (series.minQueue.count > 0 && series.minQueue.items[series.minQueue.head] == pos) {
+    series.minQueue.head = (series.minQueue.head + 1) % capacity;
+    series.minQueue.count--;
+  }
+  if (series.maxQueue.count > 0 && series.maxQueue.items[series.maxQueue.head] == pos) {
+    series.maxQueue.head = (series.maxQueue.head + 1) % capacity;
+    series.maxQueue.count--;
+  }
+  series.count--;
+  series.sumX -= value;
+  series.sumT -= t;
+  series.sumTX -= t * value;
+  series.sumTT -= t * t;
+}
+
+// При запуске окна заполняются из последних записей истории
+void replayStats() {
+  if (historyHeadSeq == 0) return;
+  
+  HistoryCursor cursor;
+  HistoryRecord entry;
+  historyCursorSeek(cursor, std::max<uint32_t>(historyFirstSeq(), historyHeadSeq > STATS_CAPACITY ? historyHeadSeq - STATS_CAPACITY + 1 : 1));
+  while (historyCursorNext(cursor, entry)) {
+    addToStats(entry);
+  }
+}
+
+// min, max, среднее и тренд (изменение за час по линейной регрессии)
+StatsSummary summarizeStats(const StatsSeries &series, bool temperature) {
+  float scale = temperature ? 100.0f : 10.0f;
+  StatsSummary summary = {series.count, NAN, NAN, NAN, NAN};
+  if (series.count == 0) return summary;
+  
+  summary.min = statsValue(statsSamples[series.minQueue.items[series.minQueue.head]], temperature) / scale;
+  summary.max = statsValue(statsSamples[series.maxQueue.items[series.maxQueue.head]], temperature) / scale;
+  summary.avg = series.sumX / (double)series.count / scale;
+  
+  double n = series.count;
+  double denominator = n * (double)series.sumTT - (double)series.sumT * (double)series.sumT;
+  if (series.count >= 2 && denominator > 0) {
+    double slope = (n * (double)series.sumTX - (double)series.sumT * (double)series.sumX) / denominator;
+    summary.trend = slope * 3600.0 / scale;
+  }
+  return summary;
+}
+
+void fillStatsJson(JsonObject stats, const StatsSummary &summary) {
+  stats["count"] = summary.count;
+  if (summary.count == 0) return;
+  stats["min"] = summary.min;
+  stats["max"] = summary.max;
+  stats["avg"] = summary.avg;
+  if (!isnan(summary.trend)) stats["trend"] = summary.trend;
+}
+
+// /stats - {"1h":{"temp":{count,min,max,avg,trend},"hum":{...}},"6h":{...},"24h":{...}}
+// trend - изменение за час (°C/ч, %/ч)
+void handleStats() {
+  server.sendHeader("Access-Control-Allow-Origin", "*");
+  if (handleNotModified(makeETag('t', historyHeadSeq), "no-cache")) return;
+  
+  DynamicJsonDocument doc(1024 + 256 * SENSOR_CHANNELS);
+  // Окна 1h/6h/24h считаются по журналу, а в нем только канал 0
+  doc["channel"] = channelNames[0];
+  for (const StatsWindow &window : statsWindows) {
+    JsonObject stats = doc.createNestedObject(window.name);
+    fillStatsJson(stats.createNestedObject("temp"), summarizeStats(window.temperature, true));
+    fillStatsJson(stats.createNestedObject("hum"), summarizeStats(window.humidity, false));
+  }
+  
+  // По каналам - за окно channelHistory (последние HISTORY_SIZE записей)
+  if (SENSOR_CHANNELS > 1) {
+    JsonArray channels = doc.createNestedArray("channels");
+    for (size_t i = 0; i < SENSOR_CHANNELS; i++) {
+      JsonObject channel = channels.createNestedObject();
+      channel["name"] = channelNames[i];
+      channel["span"] = channelHistorySpan();
+      fillStatsJson(channel.createNestedObject("temp"), summarizeChannelTemperature(i));
+      fillStatsJson(channel.createNestedObject("hum"), summarizeChannelHumidity(i));
+    }
+  }
+  
+  String json;
+  serializeJson(doc, json);
+  server.send(200, "application/json", json);
+}
+
+String formatTelegramStats() {
+  String message = "📈 *Статистика*\n";
+  for (const StatsWindow &window : statsWindows) {
+    message += "\n*За " + String(window.name) + "*\n";
+    StatsSummary series[] = {summarizeStats(window.temperature, true), summarizeStats(window.humidity, false)};
+    const char *icons[] = {"🌡️", "💧"};
+    const char *units[] = {" °C", " %"};
+    
+    if (series[0].count == 0 && series[1].count == 0) {
+      message += "нет данных\n";
+      continue;
+    }
+    for (int i = 0; i < 2; i++) {
+      if (series[i].count == 0) continue;
+      message += String(icons[i]) + " " + String(series[i].min, 1) + "…" + String(series[i].max, 1) + units[i];
+      message += ", ср. " + String(series[i].avg, 1);
+      if (!isnan(series[i].trend)) {
+        message += ", " + String(series[i].trend >= 0 ? "+" : "") + String(series[i].trend, 2) + units[i] + "/ч";
+      }
+      message += "\n";
+    }
+  }
+  
+  if (SENSOR_CHANNELS > 1) {
+    message += "\n*По каналам за " + String(channelHistorySpan() / 3600.0f, 1) + " ч*\n";
+    for (size_t i = 0; i < SENSOR_CHANNELS; i++) {
+      StatsSummary temperature = summarizeChannelTemperature(i);
+      StatsSummary humidity = summarizeChannelHumidity(i);
+      message += "📍 " + String(channelNames[i]) + ": ";
+      if (temperature.count > 0) message += "🌡️ " + String(temperature.min, 1) + "…" + String(temperature.max, 1) + " °C ";
+      if (humidity.count > 0) message += "💧 " + String(humidity.min, 1) + "…" + String(humidity.max, 1) + " %";
+      if (temperature.count == 0 && humidity.count == 0) message += "нет данных";
+      message += "\n";
+    }
+  }
+  return message;
+}
+
+// ========== Security Functions ==========
+void generateCsrfToken() {
+  const char charset[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+  csrfToken = "";
+  
+  for (int i = 0; i < CSRF_TOKEN_LENGTH; i++) {
+    csrfToken += charset[random(0, sizeof(charset) - 1)];
+  }
+}
+
+bool validateCsrf() {
+  if (server.method() == HTTP_GET) return true;
+  return server.hasArg("csrf") && server.arg("csrf") == csrfToken;
+}
+
+// ========== Web Server Handlers ==========
+// Страница, стили и график хранятся во флеше в сжатом виде и не зависят от данных:
+// показания и настройки страница получает через /sensor-data и /history-data
+void handleStaticAsset(const WebAsset &asset) {
+  // Токен передается в cookie, чтобы страница оставалась неизменной
+  server.sendHeader("Set-Cookie", "csrf=" + csrfToken + "; Path=/; SameSite=Strict");
+  if (handleNotModified(asset.etag, asset.cacheControl)) return;
+
+  server.sendHeader("Content-Encoding", "gzip");
+  server.send_P(200, asset.contentType, (const char *)asset.data, asset.length);
+}
+
+// Отправляет ETag и, если версия у клиента актуальна, пустой ответ 304
+bool handleNotModified(const String &etag, const char *cacheControl) {
+  server.sendHeader("ETag", etag);
+  server.sendHeader("Cache-Control", cacheControl);
+  
+  if (server.header("If-None-Match") == etag) {
+    server.send(304);
+    return true;
+  }
+  return false;
+}
+
+String makeETag(char kind, uint32_t version, uint32_t revision) {
+  char etag[40];
+  snprintf(etag, sizeof(etag), "\"%c%08lx-%lu.%lu\"", kind, (unsigned long)bootId, (unsigned long)version, (unsigned long)revision);
+  return String(etag);
+}
+
+// Тело ответа кешируется по версии показаний, поэтому возраст снимка
+// передается заголовком X-Sensor-Age (мс) и в том числе с ответом 304
+void handleSensorData() {
+  server.sendHeader("Access-Control-Allow-Origin", "*");
+  server.sendHeader("Access-Control-Expose-Headers", "X-Sensor-Age");
+  uint32_t age = sensorDataAge(readSensorSnapshot());
+  if (age != UINT32_MAX) {
+    server.sendHeader("X-Sensor-Age", String(age));
+  }
+  if (handleNotModified(makeETag('s', sensorDataVersion), "no-cache")) return;
+  
+  if (sensorJsonCache.length() == 0 || sensorJsonCacheVersion != sensorDataVersion) {
+    rebuildSensorJsonCache();
+  }
+  server.send(200, "application/json", sensorJsonCache);
+}
+
+void rebuildSensorJsonCache() {
+  DynamicJsonDocument doc(SENSOR_JSON_SIZE);
+  fillSensorJson(doc);
+
+  // Состояние сети и настройки для панели управления
+  doc["ip"] = isAPMode ? WiFi.softAPIP().toString() : WiFi.localIP().toString();
+  doc["ap"] = isAPMode;
+  doc["rssi"] = isAPMode ? 0 : WiFi.RSSI();
+  doc["tz"] = timeZoneOffset;
+  doc["ssid"] = wifiSettings.ssid;
+  doc["otaUser"] = otaSettings.username;
+
+  sensorJsonCache = "";
+  serializeJson(doc, sensorJsonCache);
+  sensorJsonCacheVersion = sensorDataVersion;
+}
+
+void fillSensorJson(DynamicJsonDocument &doc) {
+  SensorData data = readSensorSnapshot();
+  char timeStr[20];
+  formatEpochTime(data.epoch, timeStr, sizeof(timeStr));
+  doc["temp"] = data.temperature[0];
+  doc["hum"] = data.humidity[0];
+  if (ClimateSensors::measures(0) & SENSOR_MEASURE_PRESSURE) {
+    doc["pres"] = data.pressure[0];
+  }
+  // Все каналы, если датчиков климата несколько (канал 0 повторяет поля выше)
+  if (SENSOR_CHANNELS > 1) {
+    JsonArray channels = doc.createNestedArray("channels");
+    for (size_t i = 0; i < SENSOR_CHANNELS; i++) {
+      JsonObject channel = channels.createNestedObject();
+      channel["name"] = channelNames[i];
+      channel["temp"] = data.temperature[i];
+      channel["hum"] = data.humidity[i];
+      if (ClimateSensors::measures(i) & SENSOR_MEASURE_PRESSURE) {
+        channel["pres"] = data.pressure[i];
+      }
+    }
+  }
+  doc["rain"] = data.isRaining;
+  doc["intensity"] = data.rainIntensity;
+  doc["rainValue"] = data.rainValue;
+  doc["baseline"] = data.rainBaseline;
+  doc["threshold"] = data.rainThreshold;
+  doc["time"] = timeStr;
+}
+
+void fillHistoryJson(JsonObject record, const HistoryRecord &entry, uint32_t seq) {
+  char timeStr[20];
+  formatHistoryTime(entry, timeStr, sizeof(timeStr));
+  record["seq"] = seq;
+  record["time"] = timeStr;
+  record["t"] = entry.epoch;
+  record["temp"] = historyTemperature(entry);
+  record["hum"] = historyHumidity(entry);
+  record["rain"] = historyIsRaining(entry);
+  
+  // Пары [темп., влажн.] всех каналов, пока запись в окне channelHistory
+  int index = SENSOR_CHANNELS > 1 ? channelHistoryIndex(seq) : -1;
+  if (index >= 0) {
+    JsonArray channels = record.createNestedArray("ch");
+    for (size_t i = 0; i < SENSOR_CHANNELS; i++) {
+      JsonArray values = channels.createNestedArray();
+      values.add(unpackTemperature(channelHistory.temperature[i][index]));
+      values.add(unpackHumidity(channelHistory.humidity[i][index]));
+    }
+  }
+}
+
+// /history-data              - последние HISTORY_SIZE записей (из готового кеша)
+// /history-data?since=N      - только записи с номером больше N, в том числе из журнала во флеше
+// /history-data?limit=K      - не больше K записей (с since - ближайшие после N, без него - последние)
+// В ответе head - номер последней записи, oldest - первая из последних HISTORY_SIZE,
+// first - самая ранняя запись, которую можно запросить через since.
+void handleHistoryData() {
+  server.sendHeader("Access-Control-Allow-Origin", "*");
+  if (handleNotModified(makeETag('h', historyHeadSeq, historyTimeVersion), "no-cache")) return;
+  
+  uint32_t firstSeq = historyFirstSeq();
+  char prefix[96];
+  int prefixLength = snprintf(prefix, sizeof(prefix), "{\"head\":%lu,\"oldest\":%lu,\"first\":%lu,\"history\":",
+                              (unsigned long)historyHeadSeq, (unsigned long)historyWindowSeq(), (unsigned long)firstSeq);
+  
+  if (!server.hasArg("since") && !server.hasArg("limit")) {
+    server.setContentLength(prefixLength + historyJsonCache.length() + 1);
+    server.send(200, "application/json", prefix);
+    server.sendContent(historyJsonCache);
+    server.sendContent("}");
+    return;
+  }
+  
+  uint32_t limit = HISTORY_SIZE;
+  if (server.hasArg("limit")) {
+    limit = constrain((int)server.arg("limit").toInt(), 1, HISTORY_QUERY_MAX_LIMIT);
+  }
+  
+  uint32_t start;
+  if (server.hasArg("since")) {
+    start = std::max<uint32_t>(strtoul(server.arg("since").c_str(), nullptr, 10) + 1, firstSeq);
+  } else {
+    start = historyHeadSeq >= firstSeq + limit ? historyHeadSeq - limit + 1 : firstSeq;
+  }
+  uint32_t end = std::min<uint32_t>(historyHeadSeq, start + limit - 1);
+  
+  server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  server.send(200, "application/json", prefix);
+  server.sendContent("[");
+  
+  char recordJson[HISTORY_RECORD_JSON_SIZE + 1];
+  bool firstRecord = true;
+  HistoryCursor cursor;
+  HistoryRecord entry;
+  historyCursorSeek(cursor, start);
+  while (start > 0 && historyCursorNext(cursor, entry, end + 1)) {
+    char *out = recordJson;
+    if (!firstRecord) *out++ = ',';
+    size_t length = serializeHistoryRecord(entry, cursor.seq - 1, out, HISTORY_RECORD_JSON_SIZE);
+    server.sendContent(recordJson, length + (out - recordJson));
+    firstRecord = false;
+  }
+  
+  server.sendContent("]}");
+  server.sendContent("");
+}
+
+uint32_t historyFirstSeq() {
+  if (historyLog.partition != nullptr && historyLogBlockCount() > 0) {
+    return std::min(historyLog.firstSeq, historyOldestSeq());
+  }
+  return historyOldestSeq();
+}
+
+uint32_t historyOldestSeq() {
+  return historyHeadSeq - sensorHistory.count + 1;
+}
+
+// Первая запись окна последних HISTORY_SIZE (кеш /history-data)
+uint32_t historyWindowSeq() {
+  return historyHeadSeq - std::min<uint32_t>(sensorHistory.count, HISTORY_SIZE) + 1;
+}
+
+size_t serializeHistoryRecord(const HistoryRecord &entry, uint32_t seq, char *buffer, size_t size) {
+  StaticJsonDocument<144 + JSON_ARRAY_SIZE(SENSOR_CHANNELS) + SENSOR_CHANNELS * JSON_ARRAY_SIZE(2)> doc;
+  fillHistoryJson(doc.to<JsonObject>(), entry, seq);
+  return serializeJson(doc, buffer, size);
+}
+
+// Кеш массива записей для /history-data: [{...},{...}].
+// Место резервируется один раз, дальше записи только дописываются в конец
+// и удаляются из начала без новых выделений памяти.
+void rebuildHistoryJsonCache() {
+  historyJsonCache.reserve(HISTORY_SIZE * HISTORY_RECORD_JSON_SIZE + 8);
+  historyJsonCache = "[";
+  
+  char recordJson[HISTORY_RECORD_JSON_SIZE];
+  HistoryCursor cursor;
+  HistoryRecord entry;
+  historyCursorSeek(cursor, historyWindowSeq());
+  while (historyCursorNext(cursor, entry)) {
+    if (historyJsonCache.length() > 1) historyJsonCache += ',';
+    serializeHistoryRecord(entry, cursor.seq - 1, recordJson, sizeof(recordJson));
+    historyJsonCache += recordJson;
+  }
+  historyJsonCache += "]";
+}
+
+void appendHistoryJsonCache(const char *recordJson, bool dropOldest) {
+  if (dropOldest) {
+    // Объекты записей не содержат вложенных объектов: первая '}' закрывает самую старую
+    int end = historyJsonCache.indexOf('}');
+    int removeLength = end;
+    if (historyJsonCache.charAt(end + 1) == ',') removeLength++;
+    historyJsonCache.remove(1, removeLength);
+  }
+  
+  // Отрезаем завершающую "]" и дописываем новую запись
+  historyJsonCache.remove(historyJsonCache.length() - 1);
+  if (historyJsonCache.length() > 1) historyJsonCache += ',';
+  historyJsonCache += recordJson;
+  historyJsonCache += "]";
+}
+
+void handleSetTZ() {
+  if (server.hasArg("tz")) {
+    int tz = server.arg("tz").toInt();
+    if (tz >= -12 && tz <= 14 && tz != timeZoneOffset) {
+      timeZoneOffset = tz;
+      configLocalTime();
+      // Время в готовом JSON истории отформатировано в старом поясе
+      rebuildHistoryJsonCache();
+      historyTimeVersion++;
+    }
+  }
+  // Порог задается в отсчетах АЦП, хранится превышение над уровнем сухого датчика,
+  // чтобы порог следовал за дрейфом. Неизмененное поле формы не сдвигает порог.
+  if (server.hasArg("rain_threshold")) {
+    SensorData data = readSensorSnapshot();
+    int threshold = server.arg("rain_threshold").toInt();
+    if (threshold != data.rainThreshold) {
+      rainOnDelta = std::max(threshold - data.rainBaseline, RAIN_MIN_ON_DELTA);
+    }
+  }
+  sensorDataVersion++;
+  server.sendHeader("Location", "/");
+  server.send(303);
+}
+
+void handleCalibrate() {
+  calibrateRainSensor();
+  server.sendHeader("Location", "/");
+  server.send(303);
+}
+
+void handleSaveWiFi() {
+  if (!validateCsrf()) {
+    server.send(403, "text/plain", "Ошибка CSRF-токена");
+    return;
+  }
+  
+  if (server.method() == HTTP_POST) {
+    String newSSID = server.arg("ssid");
+    String newPass = server.arg("password");
+    
+    // Проверка длины
+    if (newSSID.length() == 0 || newSSID.length() > MAX_SSID_LENGTH - 1) {
+      server.send(400, "text/plain", "Ошибка: Некорректная длина SSID");
+      return;
+    }
+    
+    if (newPass.length() > MAX_PASSWORD_LENGTH - 1) {
+      server.send(400, "text/plain", "Ошибка: Слишком длинный пароль");
+      return;
+    }
+    
+    strlcpy(wifiSettings.ssid, newSSID.c_str(), sizeof(wifiSettings.ssid));
+    // Пустое поле означает "оставить текущий пароль"
+    if (newPass.length() > 0) {
+      strlcpy(wifiSettings.password, newPass.c_str(), sizeof(wifiSettings.password));
+    }
+    saveWiFiSettings();
+    
+    server.send(200, "text/plain", "Настройки WiFi сохранены! Перезагрузка...");
+    shouldReboot = true;
+    return;
+  }
+  server.send(400, "text/plain", "Ошибка: Неверный метод запроса");
+}
+
+void handleSaveOTA() {
+  if (!validateCsrf()) {
+    server.send(403, "text/plain", "Ошибка CSRF-токена");
+    return;
+  }
+  
+  if (server.method() == HTTP_POST) {
+    String newUser = server.arg("ota_user");
+    String newPass = server.arg("ota_pass");
     
     // Проверка длины
     if (newUser.length() == 0 || newUser.length() > MAX_SSID_LENGTH - 1) {
@@ -878,13 +2755,16 @@ void handleSaveOTA() {
       return;
     }
     
-    if (newPass.length() == 0 || newPass.length() > MAX_PASSWORD_LENGTH - 1) {
+    if (newPass.length() > MAX_PASSWORD_LENGTH - 1) {
       server.send(400, "text/plain", "Ошибка: Некорректная длина пароля");
       return;
     }
     
     strlcpy(otaSettings.username, newUser.c_str(), sizeof(otaSettings.username));
-    strlcpy(otaSettings.password, newPass.c_str(), sizeof(otaSettings.password));
+    // Пустое поле означает "оставить текущий пароль"
+    if (newPass.length() > 0) {
+      strlcpy(otaSettings.password, newPass.c_str(), sizeof(otaSettings.password));
+    }
     saveOTASettings();
     
     server.sendHeader("Location", "/");
@@ -899,6 +2779,179 @@ void handleReset() {
   shouldReboot = true;
 }
 
+// ========== Server-Sent Events ==========
+// Страница подписывается на /events вместо периодического опроса.
+// Каждое обновление сериализуется один раз и копируется в буферы всех подписчиков.
+void handleEvents() {
+  int slot = -1;
+  for (int i = 0; i < MAX_EVENT_CLIENTS; i++) {
+    if (eventClients[i].active && !eventClients[i].client.connected()) {
+      eventClients[i].client.stop();
+      eventClients[i].active = false;
+    }
+    if (!eventClients[i].active && slot < 0) slot = i;
+  }
+  
+  if (slot < 0) {
+    server.send(503, "text/plain", "Слишком много подключений");
+    return;
+  }
+  
+  // Заголовки пишутся напрямую: ответ не должен завершаться после выхода из обработчика
+  WiFiClient client = server.client();
+  client.setNoDelay(true);
+  client.print("HTTP/1.1 200 OK\r\n"
+               "Content-Type: text/event-stream\r\n"
+               "Cache-Control: no-cache\r\n"
+               "Connection: keep-alive\r\n"
+               "Access-Control-Allow-Origin: *\r\n\r\n"
+               "retry: 5000\n\n");
+  
+  eventClients[slot].client = client;
+  eventClients[slot].pendingLength = 0;
+  eventClients[slot].active = true;
+  
+  // Новый подписчик сразу получает текущие показания, остальным они не повторяются
+  publishSensorEvent(slot);
+}
+
+int activeEventClients() {
+  int count = 0;
+  for (int i = 0; i < MAX_EVENT_CLIENTS; i++) {
+    if (eventClients[i].active) count++;
+  }
+  return count;
+}
+
+// slot - только этому подписчику, -1 - всем
+void publishEvent(const char *event, const char *data, int slot) {
+  char header[32];
+  int headerLength = snprintf(header, sizeof(header), "event: %s\ndata: ", event);
+  size_t dataLength = strlen(data);
+  size_t total = headerLength + dataLength + 2;
+  
+  for (int i = 0; i < MAX_EVENT_CLIENTS; i++) {
+    EventClient &subscriber = eventClients[i];
+    if (!subscriber.active || (slot >= 0 && i != slot)) continue;
+    
+    // Клиент, который не успевает забирать данные, отключается
+    if (subscriber.pendingLength + total > EVENT_BUFFER_SIZE) {
+      subscriber.client.stop();
+      subscriber.active = false;
+      continue;
+    }
+    
+    char *out = subscriber.pending + subscriber.pendingLength;
+    memcpy(out, header, headerLength);
+    memcpy(out + headerLength, data, dataLength);
+    memcpy(out + headerLength + dataLength, "\n\n", 2);
+    subscriber.pendingLength += total;
+  }
+  
+  pumpEventClients();
+}
+
+void pumpEventClients() {
+  // Комментарий-пинг держит соединение открытым и выявляет отключившихся клиентов
+  if (millis() - lastEventKeepAlive > EVENT_KEEPALIVE_INTERVAL) {
+    lastEventKeepAlive = millis();
+    for (int i = 0; i < MAX_EVENT_CLIENTS; i++) {
+      EventClient &subscriber = eventClients[i];
+      if (subscriber.active && subscriber.pendingLength + 3 <= EVENT_BUFFER_SIZE) {
+        memcpy(subscriber.pending + subscriber.pendingLength, ":\n\n", 3);
+        subscriber.pendingLength += 3;
+      }
+    }
+  }
+  
+  for (int i = 0; i < MAX_EVENT_CLIENTS; i++) {
+    EventClient &subscriber = eventClients[i];
+    if (!subscriber.active) continue;
+    
+    if (!subscriber.client.connected()) {
+      subscriber.client.stop();
+      subscriber.active = false;
+      continue;
+    }
+    
+    if (subscriber.pendingLength == 0) continue;
+    
+    // WiFiClient::write ждет готовности сокета до нескольких секунд, поэтому запись
+    // идет напрямую в сокет без ожидания: что не поместилось, остается в буфере
+    ssize_t sent = ::send(subscriber.client.fd(), subscriber.pending, subscriber.pendingLength, MSG_DONTWAIT);
+    if (sent < 0) {
+      if (errno != EAGAIN && errno != EWOULDBLOCK) {
+        subscriber.client.stop();
+        subscriber.active = false;
+      }
+      continue;
+    }
+    
+    subscriber.pendingLength -= sent;
+    memmove(subscriber.pending, subscriber.pending + sent, subscriber.pendingLength);
+  }
+}
+
+// ========== Loop Latency ==========
+void recordLoopTime(uint32_t elapsedUs) {
+  loopStats.count++;
+  loopStats.totalUs += elapsedUs;
+  loopStats.maxUs = std::max(loopStats.maxUs, elapsedUs);
+  loopStats.peakUs = std::max(loopStats.peakUs, elapsedUs);
+  
+  if (millis() - loopStats.windowStart >= LOOP_STATS_WINDOW) {
+    loopStats.lastAvgUs = loopStats.totalUs / loopStats.count;
+    loopStats.lastMaxUs = loopStats.maxUs;
+    loopStats.windowStart = millis();
+    loopStats.count = 0;
+    loopStats.totalUs = 0;
+    loopStats.maxUs = 0;
+  }
+}
+
+// /loop-stats - длительность прохода loop() без завершающей паузы:
+// avgUs/maxUs за последнее окно LOOP_STATS_WINDOW, peakUs и sensorStepMaxUs - с запуска,
+// sensorIntervalMs - текущий период опроса датчиков, freeHeap/minFreeHeap - куча сейчас
+// и ее минимум с запуска (для нагрузочных проверок, например tools/ws_fanout.py)
+void handleLoopStats() {
+  char json[256];
+  snprintf(json, sizeof(json), "{\"windowMs\":%d,\"avgUs\":%lu,\"maxUs\":%lu,\"peakUs\":%lu,\"sensorStepMaxUs\":%lu,\"sensorIntervalMs\":%lu,"
+           "\"freeHeap\":%lu,\"minFreeHeap\":%lu}",
+           LOOP_STATS_WINDOW, (unsigned long)loopStats.lastAvgUs, (unsigned long)loopStats.lastMaxUs,
+           (unsigned long)loopStats.peakUs, (unsigned long)loopStats.sensorStepMaxUs,
+           (unsigned long)readSensorSnapshot().sampleInterval,
+           (unsigned long)ESP.getFreeHeap(), (unsigned long)ESP.getMinFreeHeap());
+  server.sendHeader("Access-Control-Allow-Origin", "*");
+  server.sendHeader("Cache-Control", "no-store");
+  server.send(200, "application/json", json);
+}
+
+// ========== WebSocket Telemetry ==========
+// ws://<ip>:81/ - поток бинарных кадров TelemetryFrame для табло и регистраторов
+void setupTelemetrySocket() {
+  telemetrySocket.begin();
+  telemetrySocket.onEvent([](uint8_t num, WStype_t type, uint8_t *payload, size_t length) {
+    if (type == WStype_CONNECTED) {
+      // Новый клиент сразу получает последние показания
+      TelemetryFrame frame;
+      fillTelemetryFrame(frame);
+      telemetrySocket.sendBIN(num, (const uint8_t *)&frame, sizeof(frame));
+    }
+  });
+}
+
+void fillTelemetryFrame(TelemetryFrame &frame) {
+  SensorData data = readSensorSnapshot();
+  frame.version = TELEMETRY_FRAME_VERSION;
+  frame.flags = (data.isRaining ? 0x01 : 0x00) | (sensorDataAge(data) > SENSOR_MAX_AGE ? 0x02 : 0x00) |
+                ((data.rainIntensity & 0x03) << 2);
+  frame.rainValue = data.rainValue;
+  frame.rainThreshold = data.rainThreshold;
+  frame.temperature = data.temperature[0];
+  frame.humidity = data.humidity[0];
+  frame.epoch = data.epoch;
+}
+
 // ========== Setup Functions ==========
 void setupOTA() {
   ArduinoOTA.setHostname("MeteoStation");
@@ -941,14 +2994,25 @@ void setupOTA() {
 void setupWebServer() {
   httpUpdater.setup(&server, "/update", otaSettings.username, otaSettings.password);
   
-  server.on("/", handleRoot);
+  const char *headerKeys[] = {"If-None-Match"};
+  server.collectHeaders(headerKeys, 1);
+  
+  for (const WebAsset &asset : WEB_ASSETS) {
+    server.on(asset.path, HTTP_GET, [&asset]() { handleStaticAsset(asset); });
+  }
   server.on("/sensor-data", handleSensorData);
   server.on("/history-data", handleHistoryData);
+  server.on("/history-range", handleHistoryRange);
+  server.on("/history", handleHistoryQuery);
+  server.on("/chart-data", handleChartData);
+  server.on("/stats", handleStats);
+  server.on("/loop-stats", handleLoopStats);
   server.on("/settz", handleSetTZ);
   server.on("/calibrate", handleCalibrate);
   server.on("/savewifi", handleSaveWiFi);
   server.on("/saveota", handleSaveOTA);
   server.on("/reset", handleReset);
+  server.on("/events", HTTP_GET, handleEvents);
   
   server.begin();
 }
@@ -956,3 +3020,11 @@ void setupWebServer() {
 void configLocalTime() {
   configTime(timeZoneOffset * 3600, 0, "pool.ntp.org", "time.nist.gov");
 }
+
+// Только часовой пояс для localtime_r, без SNTP. В POSIX TZ знак смещения обратный.
+void applyTimeZone() {
+  char tz[16];
+  snprintf(tz, sizeof(tz), "UTC%+d", -timeZoneOffset);
+  setenv("TZ", tz, 1);
+  tzset();
+}
@@ -0,0 +1,93 @@
+// Определение дождя по отфильтрованному сигналу датчика. Состояние меняется,
+// только если сигнал держится за порогом не меньше заданного времени, пороги
+// включения и выключения разные (гистерезис), оба отсчитываются от уровня
+// сухого датчика, который медленно следует за дрейфом, пока дождя нет.
+#pragma once
+
+#include <stdint.h>
+
+// Грубая оценка интенсивности по превышению над уровнем сухого датчика
+enum RainIntensity : uint8_t {
+  RAIN_NONE = 0,
+  RAIN_LIGHT,     // до 2 порогов включения
+  RAIN_MODERATE,  // до 4 порогов
+  RAIN_HEAVY
+};
+
+class RainDetector {
+public:
+  // onDwell/offDwell - мс, сколько условие должно держаться без перерыва;
+  // driftAlpha - вес нового значения в уровне сухого датчика за шаг update(),
+  // intensityAlpha - то же для сглаженного превышения (оценка интенсивности);
+  // offPercent - порог выключения в процентах от порога включения
+  RainDetector(uint32_t onDwell, uint32_t offDwell, float driftAlpha, float intensityAlpha, uint8_t offPercent)
+    : onDwell_(onDwell), offDwell_(offDwell), driftAlpha_(driftAlpha), intensityAlpha_(intensityAlpha), offPercent_(offPercent) {}
+
+  // Уровень сухого датчика задается явно (калибровка), слежение продолжается от него
+  void setBaseline(int baseline) {
+    baseline_ = baseline;
+    seeded_ = true;
+  }
+
+  // Порог включения - превышение над уровнем сухого датчика
+  void setOnDelta(int delta) { onDelta_ = delta; }
+
+  // Очередное значение сигнала, now - мс. true - состояние сменилось.
+  // Первое значение принимается за уровень сухого датчика.
+  bool update(int value, uint32_t now) {
+    if (!seeded_) setBaseline(value);
+    double excess = value - baseline_;
+    excess_ += intensityAlpha_ * (excess - excess_);
+
+    bool crossing = raining_ ? excess < offDelta() : excess > onDelta_;
+    if (!crossing) {
+      pending_ = false;
+    } else if (!pending_) {
+      pending_ = true;
+      pendingSince_ = now;
+    }
+
+    bool changed = false;
+    if (pending_ && now - pendingSince_ >= (raining_ ? offDwell_ : onDwell_)) {
+      raining_ = !raining_;
+      pending_ = false;
+      changed = true;
+    }
+
+    // Дрейф отслеживается только у сухого датчика и только ниже порога выключения:
+    // начало дождя в уровень не уходит, он замирает, пока сигнал у порога
+    if (!raining_ && !pending_ && excess < offDelta()) {
+      baseline_ += driftAlpha_ * excess;
+    }
+    return changed;
+  }
+
+  bool raining() const { return raining_; }
+  int baseline() const { return (int)(baseline_ + 0.5); }
+  int onThreshold() const { return baseline() + onDelta_; }
+  int offThreshold() const { return baseline() + (int)offDelta(); }
+
+  RainIntensity intensity() const {
+    if (!raining_) return RAIN_NONE;
+    if (excess_ < 2.0 * onDelta_) return RAIN_LIGHT;
+    if (excess_ < 4.0 * onDelta_) return RAIN_MODERATE;
+    return RAIN_HEAVY;
+  }
+
+private:
+  double offDelta() const { return onDelta_ * offPercent_ / 100.0; }
+
+  uint32_t onDwell_;
+  uint32_t offDwell_;
+  float driftAlpha_;
+  float intensityAlpha_;
+  uint8_t offPercent_;
+  int onDelta_ = 0;
+  // double: шаг дрейфа меньше единицы младшего разряда float на уровне тысяч отсчетов
+  double baseline_ = 0;
+  double excess_ = 0;
+  bool seeded_ = false;
+  bool raining_ = false;
+  bool pending_ = false;
+  uint32_t pendingSince_ = 0;
+};
@@ -0,0 +1,301 @@
+// Драйверы датчиков. Каждый драйвер - класс-политика с одинаковым набором
+// методов; нужный выбирается при сборке (ClimateSensors и RainSensor в main.cpp),
+// поэтому вызовы разрешаются статически, без виртуальных функций.
+//
+// Датчик климата:
+//   static const uint8_t measures;         // маска SENSOR_MEASURE_* измеряемых величин
+//   bool begin();                          // false - датчик не ответил
+//   bool read(ClimateReading &reading);    // false - ошибка обмена, поля каналов без данных - NAN
+//
+// Несколько датчиков климата объединяются в ClimateSensorSet: канал i - i-й драйвер списка.
+//
+// Датчик дождя (отсчеты АЦП 0..4095):
+//   void begin();                          // вызывается из задачи опроса
+//   bool continuous() const;               // данные приходят сами (DMA), а не опросом
+//   void wait(TickType_t timeout);         // ожидание новых данных, не дольше timeout
+//   bool take(int &value);                 // среднее с прошлого вызова, false - данных нет
+//
+// Имитации без оборудования - в sensor_sim.h, например
+//   -DCLIMATE_SENSORS="SimulatedClimateDriver<ArduinoClock>" -DRAIN_SENSOR="SimulatedRainDriver<ArduinoClock>"
+#pragma once
+
+#include <Arduino.h>
+#include <algorithm>
+#include <DHT.h>
+#include <Wire.h>
+#include <math.h>
+#include "sensor_set.h"
+#include "sensor_sim.h"
+
+// Часы для имитаций датчиков: время с запуска и пауза задачи FreeRTOS
+struct ArduinoClock {
+  static uint32_t millis() { return ::millis(); }
+  static void sleep(uint32_t ticks) { vTaskDelay(ticks); }
+};
+
+// ========== Climate Drivers ==========
+// DHT11/DHT22: обмен по одному проводу ~5 мс с запрещенными прерываниями,
+// влажность берется из того же обмена, что и температура
+template <uint8_t PIN, uint8_t TYPE>
+class DhtDriver {
+public:
+  static const uint8_t measures = SENSOR_MEASURE_TEMPERATURE | SENSOR_MEASURE_HUMIDITY;
+
+  DhtDriver() : dht_(PIN, TYPE) {}
+
+  bool begin() {
+    dht_.begin();
+    return true;
+  }
+
+  bool read(ClimateReading &reading) {
+    reading.temperature = dht_.readTemperature(false, true);
+    reading.humidity = dht_.readHumidity();
+    return !isnan(reading.temperature) || !isnan(reading.humidity);
+  }
+
+private:
+  DHT dht_;
+};
+
+// CRC-8 датчиков Sensirion: полином 0x31, начальное значение 0xFF
+inline uint8_t sensirionCrc8(const uint8_t *data, size_t length) {
+  uint8_t crc = 0xFF;
+  for (size_t i = 0; i < length; i++) {
+    crc ^= data[i];
+    for (int bit = 0; bit < 8; bit++) {
+      crc = (crc & 0x80) ? (crc << 1) ^ 0x31 : crc << 1;
+    }
+  }
+  return crc;
+}
+
+// SHT3x по I2C в периодическом режиме (1 измерение в секунду, высокая точность):
+// датчик измеряет сам, чтение готового результата - 6 байт по шине без ожидания
+template <uint8_t ADDRESS = 0x44>
+class Sht3xDriver {
+public:
+  static const uint8_t measures = SENSOR_MEASURE_TEMPERATURE | SENSOR_MEASURE_HUMIDITY;
+
+  bool begin() {
+    Wire.begin();
+    return command(0x2130);
+  }
+
+  bool read(ClimateReading &reading) {
+    uint8_t data[6];
+    if (!command(0xE000) || Wire.requestFrom((int)ADDRESS, 6) != 6) {
+      // После сброса питания датчик возвращается в режим одиночных измерений
+      command(0x2130);
+      return false;
+    }
+    for (int i = 0; i < 6; i++) {
+      data[i] = Wire.read();
+    }
+    if (sensirionCrc8(data, 2) != data[2] || sensirionCrc8(data + 3, 2) != data[5]) {
+      return false;
+    }
+    reading.temperature = -45.0f + 175.0f * (uint16_t)((data[0] << 8) | data[1]) / 65535.0f;
+    reading.humidity = 100.0f * (uint16_t)((data[3] << 8) | data[4]) / 65535.0f;
+    return true;
+  }
+
+private:
+  static bool command(uint16_t code) {
+    Wire.beginTransmission(ADDRESS);
+    Wire.write(code >> 8);
+    Wire.write(code & 0xFF);
+    return Wire.endTransmission() == 0;
+  }
+};
+
+// BME280 по I2C в нормальном режиме (измерение раз в секунду, без фильтра).
+// Пересчет по целочисленным формулам из документации Bosch.
+template <uint8_t ADDRESS = 0x76>
+class Bme280Driver {
+public:
+  static const uint8_t measures = SENSOR_MEASURE_TEMPERATURE | SENSOR_MEASURE_HUMIDITY | SENSOR_MEASURE_PRESSURE;
+
+  bool begin() {
+    Wire.begin();
+    uint8_t id = 0;
+    if (!readRegisters(0xD0, &id, 1) || id != 0x60) return false;
+    if (!readCalibration()) return false;
+    // ctrl_hum применяется только после записи ctrl_meas
+    return writeRegister(0xF2, 0x01) &&   // влажность x1
+           writeRegister(0xF5, 0xA0) &&   // пауза 1000 мс, фильтр выключен
+           writeRegister(0xF4, 0x27);     // температура x1, давление x1, нормальный режим
+  }
+
+  bool read(ClimateReading &reading) {
+    uint8_t data[8];
+    if (!readRegisters(0xF7, data, sizeof(data))) return false;
+    int32_t adcP = ((int32_t)data[0] << 12) | ((int32_t)data[1] << 4) | (data[2] >> 4);
+    int32_t adcT = ((int32_t)data[3] << 12) | ((int32_t)data[4] << 4) | (data[5] >> 4);
+    int32_t adcH = ((int32_t)data[6] << 8) | data[7];
+    // 0x80000 - измерение еще не выполнялось
+    if (adcT == 0x80000) return false;
+
+    int32_t fine = compensateFine(adcT);
+    reading.temperature = ((fine * 5 + 128) >> 8) / 100.0f;
+    if (adcP != 0x80000) {
+      reading.pressure = compensatePressure(adcP, fine) / 25600.0f;
+    }
+    if (adcH != 0x8000) {
+      reading.humidity = compensateHumidity(adcH, fine) / 1024.0f;
+    }
+    return true;
+  }
+
+private:
+  struct Calibration {
+    uint16_t t1;
+    int16_t t2, t3;
+    uint16_t p1;
+    int16_t p2, p3, p4, p5, p6, p7, p8, p9;
+    uint8_t h1, h3;
+    int16_t h2, h4, h5;
+    int8_t h6;
+  };
+
+  bool readCalibration() {
+    uint8_t tp[26], h[7];
+    if (!readRegisters(0x88, tp, sizeof(tp)) || !readRegisters(0xE1, h, sizeof(h))) return false;
+    cal_.t1 = le16(tp);
+    cal_.t2 = (int16_t)le16(tp + 2);
+    cal_.t3 = (int16_t)le16(tp + 4);
+    cal_.p1 = le16(tp + 6);
+    cal_.p2 = (int16_t)le16(tp + 8);
+    cal_.p3 = (int16_t)le16(tp + 10);
+    cal_.p4 = (int16_t)le16(tp + 12);
+    cal_.p5 = (int16_t)le16(tp + 14);
+    cal_.p6 = (int16_t)le16(tp + 16);
+    cal_.p7 = (int16_t)le16(tp + 18);
+    cal_.p8 = (int16_t)le16(tp + 20);
+    cal_.p9 = (int16_t)le16(tp + 22);
+    cal_.h1 = tp[25];
+    cal_.h2 = (int16_t)le16(h);
+    cal_.h3 = h[2];
+    // H4 и H5 - 12-битные знаковые, делят между собой байт 0xE5
+    cal_.h4 = (int16_t)((int8_t)h[3] * 16 | (h[4] & 0x0F));
+    cal_.h5 = (int16_t)((int8_t)h[5] * 16 | (h[4] >> 4));
+    cal_.h6 = (int8_t)h[6];
+    return true;
+  }
+
+  // t_fine - общая для всех величин поправка по температуре
+  int32_t compensateFine(int32_t adcT) const {
+    int32_t var1 = ((((adcT >> 3) - ((int32_t)cal_.t1 << 1))) * cal_.t2) >> 11;
+    int32_t var2 = (((((adcT >> 4) - (int32_t)cal_.t1) * ((adcT >> 4) - (int32_t)cal_.t1)) >> 12) * cal_.t3) >> 14;
+    return var1 + var2;
+  }
+
+  // Давление в Па в формате Q24.8
+  uint32_t compensatePressure(int32_t adcP, int32_t fine) const {
+    int64_t var1 = (int64_t)fine - 128000;
+    int64_t var2 = var1 * var1 * cal_.p6;
+    var2 = var2 + ((var1 * cal_.p5) << 17);
+    var2 = var2 + ((int64_t)cal_.p4 << 35);
+    var1 = ((var1 * var1 * cal_.p3) >> 8) + ((var1 * cal_.p2) << 12);
+    var1 = ((((int64_t)1) << 47) + var1) * cal_.p1 >> 33;
+    if (var1 == 0) return 0;
+    int64_t p = 1048576 - adcP;
+    p = (((p << 31) - var2) * 3125) / var1;
+    var1 = ((int64_t)cal_.p9 * (p >> 13) * (p >> 13)) >> 25;
+    var2 = ((int64_t)cal_.p8 * p) >> 19;
+    return (uint32_t)(((p + var1 + var2) >> 8) + ((int64_t)cal_.p7 << 4));
+  }
+
+  // Влажность в % в формате Q22.10
+  uint32_t compensateHumidity(int32_t adcH, int32_t fine) const {
+    int32_t v = fine - 76800;
+    v = (((((adcH << 14) - ((int32_t)cal_.h4 << 20) - ((int32_t)cal_.h5 * v)) + 16384) >> 15) *
+         (((((((v * cal_.h6) >> 10) * (((v * (int32_t)cal_.h3) >> 11) + 32768)) >> 10) + 2097152) * cal_.h2 + 8192) >> 14));
+    v = v - (((((v >> 15) * (v >> 15)) >> 7) * (int32_t)cal_.h1) >> 4);
+    v = std::min<int32_t>(std::max<int32_t>(v, 0), 419430400);
+    return (uint32_t)(v >> 12);
+  }
+
+  static uint16_t le16(const uint8_t *data) { return data[0] | (data[1] << 8); }
+
+  static bool readRegisters(uint8_t reg, uint8_t *data, size_t length) {
+    Wire.beginTransmission(ADDRESS);
+    Wire.write(reg);
+    if (Wire.endTransmission(false) != 0) return false;
+    if (Wire.requestFrom((int)ADDRESS, (int)length) != (int)length) return false;
+    for (size_t i = 0; i < length; i++) {
+      data[i] = Wire.read();
+    }
+    return true;
+  }
+
+  static bool writeRegister(uint8_t reg, uint8_t value) {
+    Wire.beginTransmission(ADDRESS);
+    Wire.write(reg);
+    Wire.write(value);
+    return Wire.endTransmission() == 0;
+  }
+
+  Calibration cal_ = {};
+};
+
+// ========== Rain Drivers ==========
+// Аналоговый датчик дождя. Основной режим - непрерывное чтение АЦП через DMA
+// (Arduino-ESP32 3.x): драйвер сам усредняет CONVERSIONS отсчетов кадра,
+// по готовности кадра прерывание будит задачу опроса. Если непрерывный режим
+// недоступен, take() делает FALLBACK_OVERSAMPLE вызовов analogRead().
+template <uint8_t PIN, uint32_t CONVERSIONS, uint32_t SAMPLE_RATE, uint8_t FALLBACK_OVERSAMPLE>
+class AnalogRainDriver {
+public:
+  void begin() {
+    task_ = xTaskGetCurrentTaskHandle();
+    pinMode(PIN, INPUT);
+    const uint8_t pins[] = {PIN};
+    continuous_ = analogContinuous(pins, 1, CONVERSIONS, SAMPLE_RATE, onFrame) && analogContinuousStart();
+  }
+
+  bool continuous() const { return continuous_; }
+
+  void wait(TickType_t timeout) {
+    if (!continuous_) {
+      vTaskDelay(timeout);
+      return;
+    }
+    ulTaskNotifyTake(pdTRUE, timeout);
+    adc_continuous_data_t *result = nullptr;
+    while (analogContinuousRead(&result, 0)) {
+      sum_ += result[0].avg_read_raw;
+      count_++;
+    }
+  }
+
+  bool take(int &value) {
+    if (!continuous_) {
+      for (int i = 0; i < FALLBACK_OVERSAMPLE; i++) {
+        sum_ += analogRead(PIN);
+      }
+      count_ += FALLBACK_OVERSAMPLE;
+    }
+    if (count_ == 0) return false;
+    value = sum_ / count_;
+    sum_ = 0;
+    count_ = 0;
+    return true;
+  }
+
+private:
+  // Вызывается из прерывания драйвера АЦП, когда кадр DMA готов
+  static void ARDUINO_ISR_ATTR onFrame() {
+    if (task_ != nullptr) {
+      vTaskNotifyGiveFromISR(task_, nullptr);
+    }
+  }
+
+  static TaskHandle_t task_;
+  bool continuous_ = false;
+  uint32_t sum_ = 0;
+  uint32_t count_ = 0;
+};
+
+template <uint8_t PIN, uint32_t CONVERSIONS, uint32_t SAMPLE_RATE, uint8_t FALLBACK_OVERSAMPLE>
+TaskHandle_t AnalogRainDriver<PIN, CONVERSIONS, SAMPLE_RATE, FALLBACK_OVERSAMPLE>::task_ = nullptr;
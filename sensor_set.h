@@ -0,0 +1,58 @@
+// Общая часть драйверов датчиков без зависимостей от оборудования: показания
+// датчика климата, маски измеряемых величин и набор датчиков по каналам.
+// Используется и прошивкой (sensor_drivers.h), и сборкой на компьютере.
+#pragma once
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <tuple>
+#include <utility>
+
+#define SENSOR_MEASURE_TEMPERATURE 0x01
+#define SENSOR_MEASURE_HUMIDITY 0x02
+#define SENSOR_MEASURE_PRESSURE 0x04
+
+struct ClimateReading {
+  float temperature = NAN;  // °C
+  float humidity = NAN;     // %
+  float pressure = NAN;     // гПа
+};
+
+// Набор датчиков климата, по одному на канал (улица, помещение, крыша...).
+// Перебор драйверов разворачивается при компиляции, каждый вызов прямой.
+template <typename... Drivers>
+class ClimateSensorSet {
+public:
+  static const size_t count = sizeof...(Drivers);
+  static_assert(count > 0 && count <= 8, "ClimateSensorSet supports 1..8 channels");
+
+  // Маска измеряемых величин канала
+  static uint8_t measures(size_t channel) {
+    static const uint8_t masks[] = {Drivers::measures...};
+    return masks[channel];
+  }
+
+  // Маска каналов, датчики которых ответили
+  uint8_t begin() { return beginAll(std::index_sequence_for<Drivers...>()); }
+
+  // readings[i] - показания канала i; возвращает маску успешно прочитанных каналов
+  uint8_t read(ClimateReading *readings) { return readAll(readings, std::index_sequence_for<Drivers...>()); }
+
+private:
+  template <size_t... I>
+  uint8_t beginAll(std::index_sequence<I...>) {
+    uint8_t ok = 0;
+    ((ok |= std::get<I>(drivers_).begin() ? 1 << I : 0), ...);
+    return ok;
+  }
+
+  template <size_t... I>
+  uint8_t readAll(ClimateReading *readings, std::index_sequence<I...>) {
+    uint8_t ok = 0;
+    ((ok |= std::get<I>(drivers_).read(readings[I]) ? 1 << I : 0), ...);
+    return ok;
+  }
+
+  std::tuple<Drivers...> drivers_;
+};
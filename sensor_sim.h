@@ -0,0 +1,57 @@
+// Имитация датчиков без оборудования: прошивка запускается на плате без
+// датчиков, а те же классы собираются на компьютере для тестов.
+// Время берется из параметра шаблона Clock, а не из millis():
+//   static uint32_t millis();              // мс с запуска
+//   static void sleep(uint32_t ticks);     // пауза задачи опроса
+// В прошивке это ArduinoClock из sensor_drivers.h, в тестах - ручные часы.
+#pragma once
+
+#include "sensor_set.h"
+
+// Суточный ход температуры и влажности, медленные колебания давления и
+// небольшой шум
+template <typename Clock>
+class SimulatedClimateDriver {
+public:
+  static const uint8_t measures = SENSOR_MEASURE_TEMPERATURE | SENSOR_MEASURE_HUMIDITY | SENSOR_MEASURE_PRESSURE;
+
+  bool begin() { return true; }
+
+  bool read(ClimateReading &reading) {
+    float day = Clock::millis() / 86400000.0f * 2 * (float)M_PI;
+    reading.temperature = 18.0f + 6.0f * sinf(day) + noise(0.2f);
+    reading.humidity = 60.0f - 20.0f * sinf(day) + noise(1.0f);
+    reading.pressure = 1013.0f + 4.0f * sinf(day / 3) + noise(0.1f);
+    return true;
+  }
+
+private:
+  // Равномерный шум в [-amplitude, amplitude] (линейный конгруэнтный генератор)
+  float noise(float amplitude) {
+    seed_ = seed_ * 1664525u + 1013904223u;
+    return amplitude * ((seed_ >> 8) / 8388608.0f - 1.0f);
+  }
+
+  uint32_t seed_ = 1;
+};
+
+// Датчик дождя: сухой уровень с шумом, каждые полчаса - пять минут дождя
+template <typename Clock>
+class SimulatedRainDriver {
+public:
+  void begin() {}
+
+  bool continuous() const { return false; }
+
+  void wait(uint32_t timeout) { Clock::sleep(timeout); }
+
+  bool take(int &value) {
+    seed_ = seed_ * 1664525u + 1013904223u;
+    bool raining = (Clock::millis() / 60000) % 30 < 5;
+    value = (raining ? 1600 : 1200) + (int)((seed_ >> 24) % 16) - 8;
+    return true;
+  }
+
+private:
+  uint32_t seed_ = 1;
+};
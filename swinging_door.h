@@ -0,0 +1,38 @@
+// Сжатие ряда swinging door: точка записывается, только когда промежуточные
+// измерения уже нельзя провести одной прямой от последней записанной точки
+// с отклонением не больше deviation.
+#pragma once
+
+#include <algorithm>
+#include <math.h>
+#include <stdint.h>
+
+// Коридор для одной величины: допустимые наклоны прямой от последней
+// записанной точки сужаются с каждым измерением. Пока коридор не пуст, все
+// промежуточные измерения лежат в пределах deviation от этой прямой.
+// Закрывшийся коридор больше не открывается до следующего swingingDoorStart().
+struct SwingingDoor {
+  float deviation;
+  float origin;          // значение в последней записанной точке
+  uint32_t originAt;     // время измерения этой точки, мс
+  float upper;           // наклоны, единиц в мс
+  float lower;
+};
+
+inline void swingingDoorStart(SwingingDoor &door, float value, uint32_t at) {
+  door.origin = value;
+  door.originAt = at;
+  door.upper = INFINITY;
+  door.lower = -INFINITY;
+}
+
+// false - измерение вышло из коридора. Появление или пропадание значения
+// (NAN) тоже считается выходом.
+inline bool swingingDoorAdd(SwingingDoor &door, float value, uint32_t at) {
+  if (isnan(value) || isnan(door.origin)) return isnan(value) && isnan(door.origin);
+  float dt = at - door.originAt;
+  if (dt <= 0) return true;
+  door.upper = std::min(door.upper, (value + door.deviation - door.origin) / dt);
+  door.lower = std::max(door.lower, (value - door.deviation - door.origin) / dt);
+  return door.lower <= door.upper;
+}
@@ -0,0 +1,29 @@
+// Минимальные проверки для тестов на компьютере: без сторонних библиотек,
+// ошибка печатается с местом проверки, код возврата - число ошибок.
+#pragma once
+
+#include <stdio.h>
+
+static int checkFailures = 0;
+
+#define CHECK(condition)                                                        \
+  do {                                                                          \
+    if (!(condition)) {                                                         \
+      fprintf(stderr, "%s:%d: не выполнено: %s\n", __FILE__, __LINE__, #condition); \
+      checkFailures++;                                                          \
+    }                                                                           \
+  } while (0)
+
+#define CHECK_EQ(actual, expected)                                              \
+  do {                                                                          \
+    long long a_ = (long long)(actual), e_ = (long long)(expected);             \
+    if (a_ != e_) {                                                             \
+      fprintf(stderr, "%s:%d: %s = %lld, ожидалось %lld\n", __FILE__, __LINE__, #actual, a_, e_); \
+      checkFailures++;                                                          \
+    }                                                                           \
+  } while (0)
+
+inline int checkResult(const char *name) {
+  if (checkFailures == 0) printf("%s: ok\n", name);
+  return checkFailures == 0 ? 0 : 1;
+}
@@ -0,0 +1,76 @@
+// Скорость скользящей медианы: SlidingMedian (вставка в отсортированное окно)
+// против сортировки копии окна на каждом шаге, как было до filters.h
+// (std::sort буфера в readSensors()).
+// Окна 5 и 7 - размеры из прошивки, большие - для оценки роста.
+#include "filters.h"
+
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+typedef std::chrono::steady_clock Clock;
+
+static const int SAMPLES = 2000000;
+
+template <size_t N>
+static int sortMedian(const std::vector<int> &input, double &seconds) {
+  int ring[N] = {};
+  int sorted[N];
+  size_t head = 0, count = 0;
+  int checksum = 0;
+  Clock::time_point start = Clock::now();
+  for (int value : input) {
+    ring[head] = value;
+    head = (head + 1) % N;
+    memcpy(sorted, ring, sizeof(sorted));
+    std::sort(sorted, sorted + N);
+    if (count < N) count++;
+    // Пока окно не заполнено, отсортированы и пустые ячейки: медиана сдвинута на их число
+    checksum += sorted[N - count + count / 2];
+  }
+  seconds = std::chrono::duration<double>(Clock::now() - start).count();
+  return checksum;
+}
+
+template <size_t N>
+static int slidingMedian(const std::vector<int> &input, double &seconds) {
+  SlidingMedian<int, N> median;
+  int checksum = 0;
+  Clock::time_point start = Clock::now();
+  for (int value : input) {
+    median.push(value);
+    checksum += median.value();
+  }
+  seconds = std::chrono::duration<double>(Clock::now() - start).count();
+  return checksum;
+}
+
+template <size_t N>
+static void report(const std::vector<int> &input) {
+  double sortSeconds, slidingSeconds;
+  int expected = sortMedian<N>(input, sortSeconds);
+  int actual = slidingMedian<N>(input, slidingSeconds);
+  printf("окно %3zu: сортировка %6.1f нс/значение, SlidingMedian %6.1f нс/значение, %.1fx%s\n", N,
+         sortSeconds * 1e9 / input.size(), slidingSeconds * 1e9 / input.size(), sortSeconds / slidingSeconds,
+         actual == expected ? "" : " (медианы различаются!)");
+}
+
+int main() {
+  // Отсчеты АЦП датчика дождя: шум вокруг медленно меняющегося уровня
+  std::mt19937 rng(1);
+  std::vector<int> input;
+  int level = 300;
+  for (int i = 0; i < SAMPLES; i++) {
+    if (rng() % 1000 == 0) level = 200 + rng() % 3000;
+    input.push_back(level + (int)(rng() % 41) - 20);
+  }
+  report<5>(input);
+  report<7>(input);
+  report<15>(input);
+  report<31>(input);
+  report<63>(input);
+  return 0;
+}
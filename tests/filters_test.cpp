@@ -0,0 +1,148 @@
+// Потоковые фильтры: скользящая медиана совпадает с сортировкой окна,
+// фильтр Хампеля отбрасывает одиночные выбросы и принимает сдвиг уровня,
+// EMA целого типа округляется к ближайшему.
+#include "filters.h"
+#include "check.h"
+
+#include <algorithm>
+#include <deque>
+#include <random>
+#include <vector>
+
+// Эталон: медиана последних N значений сортировкой копии окна
+template <typename T>
+static T sortedMedian(const std::deque<T> &window) {
+  std::vector<T> values(window.begin(), window.end());
+  std::sort(values.begin(), values.end());
+  return values[values.size() / 2];
+}
+
+template <size_t N>
+static void checkMedianAgainstSort(unsigned seed, int range) {
+  std::mt19937 rng(seed);
+  SlidingMedian<int, N> median;
+  std::deque<int> window;
+  for (int i = 0; i < 5000; i++) {
+    int value = (int)(rng() % range) - range / 2;
+    median.push(value);
+    window.push_back(value);
+    if (window.size() > N) window.pop_front();
+
+    CHECK_EQ(median.size(), window.size());
+    CHECK_EQ(median.oldest(), window.front());
+    CHECK_EQ(median.value(), sortedMedian(window));
+    if (median.value() != sortedMedian(window)) return;
+  }
+}
+
+static void testSlidingMedian() {
+  // Малый диапазон дает много повторов - проверка удаления одинаковых значений
+  checkMedianAgainstSort<1>(1, 100);
+  checkMedianAgainstSort<2>(2, 100);
+  checkMedianAgainstSort<5>(3, 5);
+  checkMedianAgainstSort<8>(4, 1000);
+  checkMedianAgainstSort<31>(5, 3);
+  checkMedianAgainstSort<64>(6, 100000);
+
+  // Окно после reset() заполняется заново
+  SlidingMedian<float, 3> median;
+  median.push(1.0f);
+  median.push(9.0f);
+  median.reset();
+  CHECK(median.empty());
+  median.push(4.0f);
+  CHECK_EQ(median.value(), 4);
+}
+
+static void testHampelSpike() {
+  // Зашумленный уровень 500 с одиночными выбросами: выбросы заменяются медианой.
+  // minDeviation на размах шума, как в прошивке: в окне из 7 равномерный шум
+  // иначе сам выходит за 3 MAD и часть обычных значений тоже заменялась бы.
+  std::mt19937 rng(7);
+  HampelFilter<int, 7> filter(3.0f, 10);
+  int spikes = 0;
+  for (int i = 0; i < 1000; i++) {
+    int value = 500 + (int)(rng() % 11) - 5;
+    bool spike = i > 10 && i % 37 == 0;
+    if (spike) {
+      value += i % 2 ? 400 : -400;
+      spikes++;
+    }
+    int result = filter.update(value);
+    if (spike) {
+      CHECK(result >= 495 && result <= 505);
+    } else if (i >= 3) {
+      CHECK_EQ(result, value);
+    }
+  }
+  CHECK_EQ(filter.rejected(), spikes);
+}
+
+static void testHampelLevelShift() {
+  // Устойчивый сдвиг уровня: первые N/2 значений заменяются медианой, следующее
+  // (новый уровень уже занимает большую часть окна) принимается
+  HampelFilter<int, 7> filter(3.0f, 2);
+  for (int i = 0; i < 20; i++) filter.update(100 + i % 3);
+  int accepted = -1;
+  for (int i = 0; i < 10; i++) {
+    if (filter.update(300 + i % 3) >= 300 && accepted < 0) accepted = i;
+  }
+  CHECK_EQ(accepted, 7 / 2 + 1);
+  CHECK_EQ(filter.update(301), 301);
+}
+
+static void testHampelMinDeviation() {
+  // На неизменном сигнале MAD = 0: без minDeviation выбросом считается любой шаг
+  HampelFilter<int, 5> strict(3.0f);
+  HampelFilter<int, 5> tolerant(3.0f, 3);
+  for (int i = 0; i < 10; i++) {
+    strict.update(200);
+    tolerant.update(200);
+  }
+  CHECK_EQ(strict.update(201), 200);
+  CHECK_EQ(strict.rejected(), 1);
+
+  CHECK_EQ(tolerant.update(201), 201);
+  CHECK_EQ(tolerant.update(197), 197);
+  CHECK_EQ(tolerant.rejected(), 0);
+  // Больше minDeviation - выброс
+  CHECK_EQ(tolerant.update(210), 200);
+  CHECK_EQ(tolerant.rejected(), 1);
+}
+
+static void testEmaRounding() {
+  // Первое значение принимается как есть
+  EmaFilter<int> ema(0.5f);
+  CHECK(!ema.initialized());
+  CHECK_EQ(ema.update(10), 10);
+  CHECK(ema.initialized());
+  // 10 + 0.5 * (13 - 10) = 11.5 -> 12, дальше 11.5 + 0.5 * (11 - 11.5) = 11.25 -> 11
+  CHECK_EQ(ema.update(13), 12);
+  CHECK_EQ(ema.update(11), 11);
+
+  // Отрицательные округляются от нуля так же, как положительные
+  EmaFilter<int> negative(0.5f);
+  negative.update(-10);
+  CHECK_EQ(negative.update(-13), -12);
+  CHECK_EQ(negative.update(-11), -11);
+
+  // Малый вес: постоянный сигнал не уплывает из-за округления
+  EmaFilter<int> slow(0.05f);
+  slow.update(0);
+  for (int i = 0; i < 200; i++) slow.update(700);
+  CHECK_EQ(slow.value(), 700);
+
+  // Для float без округления
+  EmaFilter<float> real(0.5f);
+  real.update(1.0f);
+  CHECK(real.update(2.0f) == 1.5f);
+}
+
+int main() {
+  testSlidingMedian();
+  testHampelSpike();
+  testHampelLevelShift();
+  testHampelMinDeviation();
+  testEmaRounding();
+  return checkResult("filters_test");
+}
@@ -0,0 +1,142 @@
+// Степень сжатия и скорость кодека истории.
+//
+// Без аргументов измеряются встроенные ряды: 30 суток записей по таймеру раз
+// в 5 минут с суточным ходом температуры и влажности, шагами DHT11 (1 °C, 1 %)
+// и DHT22 (0,1 °C, 0,1 %), с эпизодами дождя. Ряды синтетические: по ним видно
+// поведение формата, а не конкретной станции. Записанный ряд передается файлом
+// CSV (epoch,temperature,humidity,rainValue,raining - °C, %, отсчеты АЦП, 0/1):
+//     history_codec_bench station.csv
+#include "history_codec.h"
+
+#include <chrono>
+#include <math.h>
+#include <random>
+#include <stdio.h>
+#include <vector>
+
+// Исходная запись до сжатия: float, float, bool и String со временем
+// (объект 12 байт + блок в куче ~16 байт на ESP32)
+static const double LEGACY_RECORD_BYTES = 4 + 4 + 4 + 12 + 16;
+
+static HistoryRecord makeRecord(uint32_t epoch, float temperature, float humidity, int rainValue, bool raining) {
+  HistoryRecord entry;
+  entry.epoch = epoch;
+  entry.temperature = (int16_t)lroundf(temperature * 100);
+  entry.humidity = (uint16_t)lroundf(humidity * 10);
+  entry.rain = (uint16_t)(((rainValue >> HISTORY_RAIN_LEVEL_SHIFT) & HISTORY_RAIN_LEVEL_MASK) | (raining ? HISTORY_RAIN_FLAG : 0));
+  return entry;
+}
+
+// step - разрешение датчика (1 для DHT11, 0.1 для DHT22), rainNoise - шум АЦП дождя в отсчетах
+static std::vector<HistoryRecord> stationTrace(float step, int rainNoise, unsigned seed) {
+  std::mt19937 rng(seed);
+  std::normal_distribution<float> noise(0.0f, 0.15f);
+  std::vector<HistoryRecord> records;
+  uint32_t epoch = 1700000000;
+  bool raining = false;
+  int rainValue = 300;
+  for (int i = 0; i < 30 * 24 * 12; i++, epoch += 300) {
+    float hour = fmodf(i / 12.0f, 24.0f);
+    float temperature = 15 + 6 * sinf((hour - 9) * 3.14159f / 12) + noise(rng) * 4 * step;
+    float humidity = 65 - 15 * sinf((hour - 9) * 3.14159f / 12) + noise(rng) * 4 * step;
+    if (rng() % 400 == 0) raining = !raining;
+    rainValue += ((raining ? 900 : 300) - rainValue) / 4 + (rainNoise ? (int)(rng() % (2 * rainNoise + 1)) - rainNoise : 0);
+    records.push_back(makeRecord(epoch, roundf(temperature / step) * step, roundf(humidity / step) * step,
+                                 rainValue, raining));
+  }
+  return records;
+}
+
+static bool loadCsv(const char *path, std::vector<HistoryRecord> &records) {
+  FILE *file = fopen(path, "r");
+  if (!file) return false;
+  char line[128];
+  while (fgets(line, sizeof(line), file)) {
+    unsigned long epoch;
+    float temperature, humidity;
+    int rainValue, raining;
+    if (sscanf(line, "%lu,%f,%f,%d,%d", &epoch, &temperature, &humidity, &rainValue, &raining) == 5) {
+      records.push_back(makeRecord(epoch, temperature, humidity, rainValue, raining != 0));
+    }
+  }
+  fclose(file);
+  return !records.empty();
+}
+
+// Раскладка по блокам, как в historyStoreAppend()
+static std::vector<HistoryBlock> encodeAll(const std::vector<HistoryRecord> &records) {
+  std::vector<HistoryBlock> blocks;
+  HistoryCodecState state = {};
+  for (const HistoryRecord &entry : records) {
+    if (blocks.empty() || historyBlockFull(blocks.back())) {
+      blocks.push_back(HistoryBlock{});
+      state = {};
+    }
+    encodeHistoryRecord(blocks.back(), state, entry);
+    blocks.back().count++;
+  }
+  return blocks;
+}
+
+static uint64_t decodeAll(const std::vector<HistoryBlock> &blocks) {
+  uint64_t checksum = 0;
+  for (const HistoryBlock &block : blocks) {
+    uint16_t bitPos = 0;
+    HistoryCodecState state = {};
+    HistoryRecord entry;
+    for (uint16_t i = 0; i < block.count; i++) {
+      decodeHistoryRecord(block, bitPos, state, entry);
+      checksum += entry.epoch + entry.temperature + entry.humidity + entry.rain;
+    }
+  }
+  return checksum;
+}
+
+static void report(const char *name, const std::vector<HistoryRecord> &records) {
+  typedef std::chrono::steady_clock Clock;
+  const int rounds = 50;
+
+  std::vector<HistoryBlock> blocks;
+  Clock::time_point start = Clock::now();
+  for (int r = 0; r < rounds; r++) blocks = encodeAll(records);
+  double encodeSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+  volatile uint64_t sink = 0;
+  start = Clock::now();
+  for (int r = 0; r < rounds; r++) sink = sink + decodeAll(blocks);
+  double decodeSeconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+  // Занятая память: блоки целиком, с заголовком и незаполненным хвостом
+  double payloadBits = 0;
+  for (const HistoryBlock &block : blocks) payloadBits += block.bitLength;
+  double bytesPerRecord = blocks.size() * sizeof(HistoryBlock) / (double)records.size();
+  // Во флеше блок лежит с CRC, сегмент - заголовок и HISTORY_LOG_BLOCKS блоков
+  double flashBytesPerRecord = blocks.size() * (HISTORY_LOG_SECTOR_SIZE / (double)HISTORY_LOG_BLOCKS) / records.size();
+  double total = (double)records.size() * rounds;
+
+  printf("%s: %zu записей, %zu блоков\n", name, records.size(), blocks.size());
+  printf("  %.2f бит/запись в потоке, %.2f байт/запись с блоками\n", payloadBits / records.size(), bytesPerRecord);
+  printf("  память: %.1fx к HistoryRecord (%zu байт), %.1fx к исходной записи (~%.0f байт)\n",
+         sizeof(HistoryRecord) / bytesPerRecord, sizeof(HistoryRecord), LEGACY_RECORD_BYTES / bytesPerRecord,
+         LEGACY_RECORD_BYTES);
+  printf("  флеш: %.2f байт/запись, %.1fx к HistoryLogEntry (%zu байт на запись)\n", flashBytesPerRecord,
+         sizeof(HistoryLogEntry) / flashBytesPerRecord, sizeof(HistoryLogEntry));
+  printf("  кодирование %.1f млн записей/с, декодирование %.1f млн записей/с\n",
+         total / encodeSeconds / 1e6, total / decodeSeconds / 1e6);
+}
+
+int main(int argc, char **argv) {
+  if (argc > 1) {
+    std::vector<HistoryRecord> records;
+    if (!loadCsv(argv[1], records)) {
+      fprintf(stderr, "%s: нет записей\n", argv[1]);
+      return 1;
+    }
+    report(argv[1], records);
+    return 0;
+  }
+  report("DHT11, 30 суток по 5 мин", stationTrace(1.0f, 2, 1));
+  report("DHT22, 30 суток по 5 мин", stationTrace(0.1f, 2, 2));
+  report("DHT11, АЦП дождя без шума", stationTrace(1.0f, 0, 3));
+  return 0;
+}
@@ -0,0 +1,141 @@
+// Кодек сжатых блоков истории: запись и чтение дают исходные записи при любых
+// значениях полей, худший случай укладывается в HISTORY_RECORD_MAX_BITS.
+#include "history_codec.h"
+#include "check.h"
+
+#include <random>
+#include <string.h>
+#include <vector>
+
+static bool sameRecord(const HistoryRecord &a, const HistoryRecord &b) {
+  return a.epoch == b.epoch && a.temperature == b.temperature && a.humidity == b.humidity && a.rain == b.rain;
+}
+
+// Записи раскладываются по блокам так же, как в historyStoreAppend(), и читаются обратно
+static void checkRoundTrip(const std::vector<HistoryRecord> &records) {
+  std::vector<HistoryBlock> blocks;
+  HistoryCodecState state = {};
+  for (const HistoryRecord &entry : records) {
+    if (blocks.empty() || historyBlockFull(blocks.back())) {
+      blocks.push_back(HistoryBlock{});
+      state = {};
+    }
+    uint16_t before = blocks.back().bitLength;
+    encodeHistoryRecord(blocks.back(), state, entry);
+    CHECK(blocks.back().bitLength - before <= HISTORY_RECORD_MAX_BITS);
+    blocks.back().count++;
+  }
+
+  size_t n = 0;
+  for (const HistoryBlock &block : blocks) {
+    CHECK(block.count <= HISTORY_BLOCK_MAX_RECORDS);
+    uint16_t bitPos = 0;
+    HistoryCodecState decoder = {};
+    for (uint16_t i = 0; i < block.count; i++, n++) {
+      HistoryRecord decoded;
+      decodeHistoryRecord(block, bitPos, decoder, decoded);
+      if (!sameRecord(decoded, records[n])) {
+        fprintf(stderr, "запись %zu: %u/%d/%u/%u вместо %u/%d/%u/%u\n", n,
+                (unsigned)decoded.epoch, decoded.temperature, decoded.humidity, decoded.rain,
+                (unsigned)records[n].epoch, records[n].temperature, records[n].humidity, records[n].rain);
+        checkFailures++;
+        return;
+      }
+    }
+    CHECK_EQ(bitPos, block.bitLength);
+  }
+  CHECK_EQ(n, records.size());
+}
+
+static void testSlowSeries() {
+  // Шаги DHT11 с ровным периодом: почти все поля кодируются одним битом
+  std::vector<HistoryRecord> records;
+  for (uint32_t i = 0; i < 1000; i++) {
+    records.push_back({1700000000 + i * 300, (int16_t)(2000 + (i / 37) % 5 * 100), (uint16_t)(550 + (i / 53) % 3 * 10), 18});
+  }
+  checkRoundTrip(records);
+
+  // Неизменные показания: блок закрывается по числу записей, а не по размеру
+  std::vector<HistoryRecord> constant(HISTORY_BLOCK_MAX_RECORDS * 3, HistoryRecord{0, 2000, 550, 18});
+  checkRoundTrip(constant);
+}
+
+static void testExtremes() {
+  // Пропуски значений, время без синхронизации и назад, предельные значения полей
+  std::vector<HistoryRecord> records = {
+    {0, HISTORY_NO_VALUE, HISTORY_NO_HUMIDITY, 0},
+    {1700000000, -4000, 0, HISTORY_RAIN_FLAG | 255},
+    {1700000300, 8500, 1000, 0},
+    {1699999000, INT16_MAX, HISTORY_NO_HUMIDITY, HISTORY_RAIN_FLAG},
+    {0xFFFFFFFF, HISTORY_NO_VALUE, 0, 255},
+    {0, 0, 0, 0},
+    {1700000000, 0, 0, 0},
+  };
+  checkRoundTrip(records);
+}
+
+static void testRandomFields() {
+  std::mt19937 rng(12345);
+  std::vector<HistoryRecord> records;
+  uint32_t epoch = 1700000000;
+  for (int i = 0; i < 20000; i++) {
+    // Смесь малых и больших шагов, чтобы пройти все ветви префиксного кода
+    switch (rng() % 4) {
+      case 0: epoch += 300; break;
+      case 1: epoch += 60 + rng() % 600; break;
+      case 2: epoch += rng() % 100000; break;
+      default: epoch = rng(); break;
+    }
+    HistoryRecord entry;
+    entry.epoch = rng() % 50 == 0 ? 0 : epoch;
+    entry.temperature = (int16_t)(rng() % 3 == 0 ? rng() : 2000 + (int)(rng() % 200) - 100);
+    entry.humidity = (uint16_t)(rng() % 3 == 0 ? rng() : 500 + rng() % 40);
+    entry.rain = (uint16_t)((rng() % 2 ? HISTORY_RAIN_FLAG : 0) | (rng() % 256));
+    records.push_back(entry);
+  }
+  checkRoundTrip(records);
+}
+
+static void testWorstCaseSize() {
+  // Самая длинная запись: все поля записаны целиком
+  HistoryBlock block = {};
+  HistoryCodecState state = {};
+  encodeHistoryRecord(block, state, {0x80000000, INT16_MIN, 0xFFFF, HISTORY_RAIN_FLAG | HISTORY_RAIN_LEVEL_MASK});
+  CHECK_EQ(block.bitLength, HISTORY_RECORD_MAX_BITS);
+
+  // Запись, совпадающая с предыдущей по всем полям и шагу времени, - 3 бита
+  HistoryBlock steady = {};
+  HistoryCodecState steadyState = {};
+  encodeHistoryRecord(steady, steadyState, {1000, 2000, 500, 10});
+  encodeHistoryRecord(steady, steadyState, {1300, 2000, 500, 10});
+  uint16_t before = steady.bitLength;
+  encodeHistoryRecord(steady, steadyState, {1600, 2000, 500, 10});
+  CHECK_EQ(steady.bitLength - before, 3);
+}
+
+static void testSensorSteps() {
+  // Дрожание DHT11 на 1 °C (100) и плавный ход влажности DHT22: после первых
+  // записей темп. стоит 3 бита, влажность 1 бит, вся запись - 5 бит
+  std::vector<HistoryRecord> records;
+  HistoryBlock block = {};
+  HistoryCodecState state = {};
+  for (uint32_t i = 0; i < 150; i++) {
+    records.push_back({1700000000 + i * 300, (int16_t)(2000 + (i % 2) * 100), (uint16_t)(400 + i * 10), 20});
+  }
+  uint16_t warmup = 0;
+  for (uint32_t i = 0; i < records.size(); i++) {
+    encodeHistoryRecord(block, state, records[i]);
+    if (i == 9) warmup = block.bitLength;
+  }
+  CHECK_EQ(block.bitLength - warmup, (records.size() - 10) * 5);
+  checkRoundTrip(records);
+}
+
+int main() {
+  testSlowSeries();
+  testSensorSteps();
+  testExtremes();
+  testRandomFields();
+  testWorstCaseSize();
+  return checkResult("history_codec_test");
+}
@@ -0,0 +1,135 @@
+// Определение дождя: гистерезис порогов включения и выключения, отбрасывание
+// коротких выходов за порог (время удержания) и неподвижный уровень сухого
+// датчика, пока решается смена состояния.
+#include "rain_detector.h"
+#include "check.h"
+
+// Параметры как в main.cpp, порог включения 100 над сухим уровнем
+static RainDetector makeDetector() {
+  RainDetector detector(10000, 120000, 0.0002f, 0.02f, 60);
+  detector.setBaseline(1000);
+  detector.setOnDelta(100);
+  return detector;
+}
+
+// Подает value каждые step мс в течение duration, возвращает число смен состояния
+static int feed(RainDetector &detector, uint32_t &now, int value, uint32_t duration, uint32_t step = 100) {
+  int changes = 0;
+  for (uint32_t end = now + duration; now < end;) {
+    now += step;
+    if (detector.update(value, now)) changes++;
+  }
+  return changes;
+}
+
+static void testThresholds() {
+  RainDetector detector = makeDetector();
+  CHECK_EQ(detector.onThreshold(), 1100);
+  CHECK_EQ(detector.offThreshold(), 1060);
+  CHECK(!detector.raining());
+  CHECK_EQ(detector.intensity(), RAIN_NONE);
+}
+
+static void testHysteresis() {
+  RainDetector detector = makeDetector();
+  uint32_t now = 0;
+
+  // Между порогами сухой датчик дождь не включает
+  CHECK_EQ(feed(detector, now, 1080, 60000), 0);
+  CHECK(!detector.raining());
+
+  // Выше порога включения дольше onDwell - дождь
+  CHECK_EQ(feed(detector, now, 1200, 11000), 1);
+  CHECK(detector.raining());
+
+  // Между порогами идущий дождь не выключается, как бы долго это ни длилось
+  CHECK_EQ(feed(detector, now, 1080, 300000), 0);
+  CHECK(detector.raining());
+
+  // Ниже порога выключения дольше offDwell - дождь кончился
+  CHECK_EQ(feed(detector, now, 1000, 121000), 1);
+  CHECK(!detector.raining());
+}
+
+static void testDwellBoundary() {
+  // Смена ровно через onDwell после первого значения за порогом, не раньше
+  RainDetector detector = makeDetector();
+  CHECK(!detector.update(1200, 1000));
+  CHECK(!detector.update(1200, 10999));
+  CHECK(detector.update(1200, 11000));
+  CHECK(detector.raining());
+}
+
+static void testShortExcursions() {
+  RainDetector detector = makeDetector();
+  uint32_t now = 0;
+
+  // Выбросы за порог по 9 с с возвратом к сухому уровню: отсчет каждый раз заново
+  for (int i = 0; i < 20; i++) {
+    CHECK_EQ(feed(detector, now, 1500, 9000), 0);
+    CHECK_EQ(feed(detector, now, 1000, 200), 0);
+  }
+  CHECK(!detector.raining());
+
+  // Во время дождя короткие провалы ниже порога выключения его не прерывают
+  CHECK_EQ(feed(detector, now, 1500, 11000), 1);
+  for (int i = 0; i < 10; i++) {
+    CHECK_EQ(feed(detector, now, 1000, 110000), 0);
+    CHECK_EQ(feed(detector, now, 1500, 200), 0);
+  }
+  CHECK(detector.raining());
+}
+
+static void testBaselineFrozenWhilePending() {
+  RainDetector detector = makeDetector();
+  uint32_t now = 0;
+
+  // Ниже порога выключения уровень следует за дрейфом
+  feed(detector, now, 1030, 600000);
+  int drifted = detector.baseline();
+  CHECK(drifted > 1010 && drifted <= 1030);
+
+  // Пока сигнал за порогом включения и смена еще не решена - уровень не двигается
+  int threshold = detector.onThreshold();
+  CHECK_EQ(feed(detector, now, threshold + 50, 9000), 0);
+  CHECK_EQ(detector.baseline(), drifted);
+
+  // Между порогами, без ожидания смены, уровень тоже стоит: начало дождя в него не уходит
+  feed(detector, now, detector.offThreshold() + 10, 600000);
+  CHECK_EQ(detector.baseline(), drifted);
+
+  // Во время дождя уровень не меняется вовсе
+  CHECK_EQ(feed(detector, now, threshold + 200, 11000), 1);
+  feed(detector, now, threshold + 200, 600000);
+  CHECK_EQ(detector.baseline(), drifted);
+}
+
+static void testIntensity() {
+  RainDetector detector = makeDetector();
+  uint32_t now = 0;
+  feed(detector, now, 1150, 60000);
+  CHECK_EQ(detector.intensity(), RAIN_LIGHT);
+  feed(detector, now, 1300, 60000);
+  CHECK_EQ(detector.intensity(), RAIN_MODERATE);
+  feed(detector, now, 1600, 60000);
+  CHECK_EQ(detector.intensity(), RAIN_HEAVY);
+}
+
+static void testFirstValueSeedsBaseline() {
+  RainDetector detector(10000, 120000, 0.0002f, 0.02f, 60);
+  detector.setOnDelta(100);
+  detector.update(2345, 0);
+  CHECK_EQ(detector.baseline(), 2345);
+  CHECK(!detector.raining());
+}
+
+int main() {
+  testThresholds();
+  testHysteresis();
+  testDwellBoundary();
+  testShortExcursions();
+  testBaselineFrozenWhilePending();
+  testIntensity();
+  testFirstValueSeedsBaseline();
+  return checkResult("rain_detector_test");
+}
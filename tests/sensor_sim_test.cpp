@@ -0,0 +1,107 @@
+// Имитации датчиков из sensor_sim.h на ручных часах: набор каналов климата,
+// суточный ход и цепочка обработки дождя из задачи опроса (Хампель, EMA,
+// RainDetector) на имитированных эпизодах дождя.
+#include "sensor_sim.h"
+#include "filters.h"
+#include "rain_detector.h"
+#include "check.h"
+
+#include <vector>
+
+// Часы теста: время идет только в sleep() (тик - 1 мс, как в прошивке)
+struct ManualClock {
+  static uint32_t now;
+  static uint32_t millis() { return now; }
+  static void sleep(uint32_t ticks) { now += ticks; }
+};
+uint32_t ManualClock::now = 0;
+
+static const uint32_t MINUTE = 60000;
+static const uint32_t HOUR = 60 * MINUTE;
+
+static void testClimateSet() {
+  ClimateSensorSet<SimulatedClimateDriver<ManualClock>, SimulatedClimateDriver<ManualClock>> climate;
+  CHECK_EQ(climate.count, 2);
+  CHECK(climate.measures(1) & SENSOR_MEASURE_PRESSURE);
+  CHECK_EQ(climate.begin(), 0x03);
+
+  ClimateReading readings[2];
+  CHECK_EQ(climate.read(readings), 0x03);
+  for (const ClimateReading &reading : readings) {
+    CHECK(reading.temperature > 17 && reading.temperature < 19);
+    CHECK(reading.humidity > 58 && reading.humidity < 62);
+    CHECK(reading.pressure > 1012 && reading.pressure < 1014);
+  }
+
+  // Суточный ход: максимум температуры и минимум влажности через 6 ч, наоборот - через 18 ч
+  ManualClock::now = 6 * HOUR;
+  ClimateReading warm[2];
+  climate.read(warm);
+  ManualClock::now = 18 * HOUR;
+  ClimateReading cold[2];
+  climate.read(cold);
+  CHECK(warm[0].temperature > 23.5f && cold[0].temperature < 12.5f);
+  CHECK(warm[0].humidity < 41.5f && cold[0].humidity > 78.5f);
+}
+
+static void testRainDriver() {
+  SimulatedRainDriver<ManualClock> rain;
+  rain.begin();
+  CHECK(!rain.continuous());
+
+  ManualClock::now = 0;
+  rain.wait(250);
+  CHECK_EQ(ManualClock::now, 250);
+
+  // Первые 5 минут каждого получаса - дождь
+  int value = 0;
+  CHECK(rain.take(value));
+  CHECK(value >= 1592 && value < 1608);
+  ManualClock::now = 5 * MINUTE;
+  CHECK(rain.take(value));
+  CHECK(value >= 1192 && value < 1208);
+  ManualClock::now = 30 * MINUTE + 1;
+  CHECK(rain.take(value));
+  CHECK(value >= 1592);
+}
+
+static void testRainPipeline() {
+  // Параметры из main.cpp; порог включения - половина скачка имитации
+  const uint32_t step = 100, onDwell = 10000, offDwell = 120000;
+  SimulatedRainDriver<ManualClock> rain;
+  HampelFilter<int, 7> outliers(3.0f, 8);
+  EmaFilter<int> smoothing(0.3f);
+  RainDetector detector(onDwell, offDwell, 0.0002f, 0.02f, 60);
+  detector.setOnDelta(200);
+
+  // Начало в сухой промежуток, чтобы первое значение задало уровень сухого датчика
+  ManualClock::now = 5 * MINUTE;
+  std::vector<uint32_t> onsets, ends;
+  while (ManualClock::now < 100 * MINUTE) {
+    rain.wait(step);
+    int value;
+    CHECK(rain.take(value));
+    if (detector.update(smoothing.update(outliers.update(value)), ManualClock::now)) {
+      (detector.raining() ? onsets : ends).push_back(ManualClock::now);
+    }
+  }
+
+  // Дожди в 30, 60 и 90 минут: каждый начинается через onDwell (с запаздыванием
+  // фильтров в несколько шагов) и кончается через offDwell после конца эпизода
+  CHECK_EQ(onsets.size(), 3);
+  CHECK_EQ(ends.size(), 3);
+  for (size_t i = 0; i < onsets.size() && i < ends.size(); i++) {
+    uint32_t start = (uint32_t)(i + 1) * 30 * MINUTE;
+    CHECK(onsets[i] >= start + onDwell && onsets[i] <= start + onDwell + 10 * step);
+    CHECK(ends[i] >= start + 5 * MINUTE + offDwell && ends[i] <= start + 5 * MINUTE + offDwell + 10 * step);
+  }
+  // Сухой уровень не ушел за время дождей
+  CHECK(detector.baseline() >= 1190 && detector.baseline() <= 1210);
+}
+
+int main() {
+  testClimateSet();
+  testRainDriver();
+  testRainPipeline();
+  return checkResult("sensor_sim_test");
+}
@@ -0,0 +1,95 @@
+// Коридор swinging door: прямая и шум в пределах отклонения коридор не
+// закрывают, излом наклона закрывает на первом измерении за коридором,
+// закрытый коридор остается закрытым.
+#include "swinging_door.h"
+#include "check.h"
+
+static SwingingDoor startDoor(float deviation, float value, uint32_t at) {
+  SwingingDoor door = {deviation, NAN, 0, INFINITY, -INFINITY};
+  swingingDoorStart(door, value, at);
+  return door;
+}
+
+static void testLinearRamp() {
+  // Рост 0.1 °C в минуту на протяжении суток - одна прямая
+  SwingingDoor door = startDoor(0.3f, 10.0f, 0);
+  bool fits = true;
+  for (uint32_t minute = 1; minute <= 24 * 60; minute++) {
+    fits = swingingDoorAdd(door, 10.0f + 0.1f * minute, minute * 60000) && fits;
+  }
+  CHECK(fits);
+}
+
+static void testNoiseWithinDeviation() {
+  // Ровный сигнал с шумом +-deviation: через все точки проходит горизонталь
+  SwingingDoor door = startDoor(2.0f, 50.0f, 1000);
+  bool fits = true;
+  for (uint32_t i = 1; i <= 500; i++) {
+    float noise = (i % 3 == 0 ? 2.0f : i % 3 == 1 ? -2.0f : 0.5f);
+    fits = swingingDoorAdd(door, 50.0f + noise, 1000 + i * 5000) && fits;
+  }
+  CHECK(fits);
+}
+
+static void testSlopeChange() {
+  // 20 минут ровно, затем рост 0.1 °C в минуту: коридор 0.3 °C закрывается,
+  // когда излом уже нельзя провести одной прямой от начала
+  SwingingDoor door = startDoor(0.3f, 20.0f, 0);
+  int closedAt = -1;
+  for (int minute = 1; minute <= 60 && closedAt < 0; minute++) {
+    float value = minute <= 20 ? 20.0f : 20.0f + 0.1f * (minute - 20);
+    if (!swingingDoorAdd(door, value, minute * 60000)) closedAt = minute;
+  }
+  // Верхний наклон задает точка на 20-й минуте: 0.3 / 20 в минуту. Нижний на
+  // минуте m - (0.1(m - 20) - 0.3) / m, он превышает верхний при m > 27.06
+  CHECK_EQ(closedAt, 28);
+}
+
+static void testStep() {
+  // После измерения на 20.1 наклон не больше 0.4 в минуту: 21.0 через две минуты
+  // еще ложится на прямую, 21.5 - уже нет
+  SwingingDoor door = startDoor(0.3f, 20.0f, 0);
+  CHECK(swingingDoorAdd(door, 20.1f, 60000));
+  SwingingDoor copy = door;
+  CHECK(swingingDoorAdd(copy, 21.0f, 120000));
+  CHECK(!swingingDoorAdd(door, 21.5f, 120000));
+}
+
+static void testClosedStaysClosed() {
+  // После закрытия коридор не открывается, даже если сигнал вернулся на прямую:
+  // поэтому при отложенной записи последним уложившимся остается измерение до закрытия
+  SwingingDoor door = startDoor(0.3f, 20.0f, 0);
+  CHECK(swingingDoorAdd(door, 20.0f, 60000));
+  CHECK(!swingingDoorAdd(door, 25.0f, 120000));
+  CHECK(!swingingDoorAdd(door, 20.0f, 180000));
+  CHECK(!swingingDoorAdd(door, 20.0f, 240000));
+
+  // Новое начало открывает коридор заново
+  swingingDoorStart(door, 20.0f, 240000);
+  CHECK(swingingDoorAdd(door, 20.0f, 300000));
+}
+
+static void testMissingValues() {
+  // Пропуск значения (NAN) закрывает коридор, серия пропусков - нет
+  SwingingDoor door = startDoor(0.3f, 20.0f, 0);
+  CHECK(!swingingDoorAdd(door, NAN, 60000));
+
+  SwingingDoor missing = startDoor(0.3f, NAN, 0);
+  CHECK(swingingDoorAdd(missing, NAN, 60000));
+  CHECK(!swingingDoorAdd(missing, 20.0f, 120000));
+
+  // Измерение с тем же временем, что и начало, коридор не сужает
+  SwingingDoor same = startDoor(0.3f, 20.0f, 5000);
+  CHECK(swingingDoorAdd(same, 30.0f, 5000));
+  CHECK(same.upper == INFINITY && same.lower == -INFINITY);
+}
+
+int main() {
+  testLinearRamp();
+  testNoiseWithinDeviation();
+  testSlopeChange();
+  testStep();
+  testClosedStaysClosed();
+  testMissingValues();
+  return checkResult("swinging_door_test");
+}
@@ -0,0 +1,101 @@
+#!/usr/bin/env python3
+"""Упаковка веб-интерфейса в web_assets.h.
+
+Каждый файл из web/ минимально ужимается (убираются отступы и пустые
+строки), сжимается gzip и записывается в прошивку как массив PROGMEM.
+ETag вычисляется по содержимому, поэтому меняется только вместе с файлом.
+
+Стили и скрипты подключаются из index.html через подстановки {{имя файла}},
+которые заменяются на URL с хешем содержимого (/style.css?v=...). Такие
+файлы отдаются с Cache-Control: immutable и после первой загрузки берутся
+браузером из кеша. Все ресурсы локальные: страница работает и в режиме
+точки доступа без выхода в интернет.
+
+Запуск из корня репозитория после изменения файлов в web/:
+    python3 tools/build_web.py
+"""
+
+import gzip
+import hashlib
+import os
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+WEB_DIR = os.path.join(ROOT, "web")
+OUTPUT = os.path.join(ROOT, "web_assets.h")
+
+# (URL, файл в web/, Content-Type, имя массива, неизменяемый)
+# Неизменяемые ресурсы должны идти раньше страниц, которые на них ссылаются.
+ASSETS = [
+    ("/style.css", "style.css", "text/css", "STYLE_CSS", True),
+    ("/chart.js", "chart.js", "application/javascript", "CHART_JS", True),
+    ("/", "index.html", "text/html; charset=UTF-8", "INDEX_HTML", False),
+]
+
+CACHE_IMMUTABLE = "public, max-age=31536000, immutable"
+CACHE_REVALIDATE = "no-cache"
+
+
+def minify(text):
+    lines = (line.strip() for line in text.splitlines())
+    return "\n".join(line for line in lines if line)
+
+
+def compress(data):
+    # mtime=0 делает результат воспроизводимым между сборками
+    return gzip.compress(data, compresslevel=9, mtime=0)
+
+
+def c_array(name, data):
+    rows = []
+    for i in range(0, len(data), 16):
+        rows.append("  " + ", ".join("0x%02x" % b for b in data[i:i + 16]))
+    return "const uint8_t %s_GZ[] PROGMEM = {\n%s\n};\n" % (name, ",\n".join(rows))
+
+
+def main():
+    parts = [
+        "// Сгенерировано tools/build_web.py из каталога web/ - не редактировать вручную.\n",
+        "#pragma once\n\n",
+        "struct WebAsset {\n",
+        "  const char *path;\n",
+        "  const char *contentType;\n",
+        "  const uint8_t *data;\n",
+        "  size_t length;\n",
+        "  const char *etag;\n",
+        "  const char *cacheControl;\n",
+        "};\n\n",
+    ]
+    table = []
+    versioned = {}
+
+    for url, filename, content_type, name, immutable in ASSETS:
+        with open(os.path.join(WEB_DIR, filename), encoding="utf-8") as f:
+            text = minify(f.read())
+        for placeholder, target in versioned.items():
+            text = text.replace("{{%s}}" % placeholder, target)
+        if "{{" in text:
+            raise SystemExit("%s: неизвестная подстановка" % filename)
+        raw = text.encode("utf-8")
+        packed = compress(raw)
+        digest = hashlib.sha1(packed).hexdigest()[:16]
+        etag = '"%s"' % digest
+        if immutable:
+            versioned[filename] = "%s?v=%s" % (url, digest)
+
+        parts.append("// %s: %d байт, gzip %d байт\n" % (filename, len(raw), len(packed)))
+        parts.append(c_array(name, packed))
+        parts.append("\n")
+        table.append('  { "%s", "%s", %s_GZ, sizeof(%s_GZ), "%s", "%s" },\n'
+                     % (url, content_type, name, name, etag.replace('"', '\\"'),
+                        CACHE_IMMUTABLE if immutable else CACHE_REVALIDATE))
+
+    parts.append("const WebAsset WEB_ASSETS[] = {\n")
+    parts.extend(table)
+    parts.append("};\n")
+
+    with open(OUTPUT, "w", encoding="utf-8") as f:
+        f.write("".join(parts))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,176 @@
+#!/usr/bin/env python3
+"""Нагрузочная проверка канала телеметрии WebSocket (ws://<ip>:81/).
+
+Подключает N клиентов, разбирает бинарные кадры TelemetryFrame и считает
+разброс доставки одного кадра по клиентам (от первого получившего до
+последнего) - так видно, во что обходится рассылка на N подписчиков.
+Параллельно раз в секунду опрашивается /loop-stats: свободная куча,
+ее минимум с запуска и длительность прохода loop().
+
+Только стандартная библиотека, без сторонних пакетов:
+    python3 tools/ws_fanout.py 192.168.1.50 --clients 8 --duration 120
+"""
+
+import argparse
+import asyncio
+import base64
+import json
+import os
+import statistics
+import struct
+import time
+import urllib.request
+
+# Раскладка TelemetryFrame из main.cpp (little-endian, без выравнивания)
+FRAME = struct.Struct("<BBHHffI")
+FRAME_VERSION = 1
+
+
+def decode_frame(payload):
+    version, flags, rain_value, threshold, temperature, humidity, epoch = FRAME.unpack(payload)
+    if version != FRAME_VERSION:
+        raise ValueError("неизвестная версия кадра %d" % version)
+    return {
+        "raining": bool(flags & 0x01),
+        "stale": bool(flags & 0x02),
+        "intensity": (flags >> 2) & 0x03,
+        "rainValue": rain_value,
+        "threshold": threshold,
+        "temperature": temperature,
+        "humidity": humidity,
+        "epoch": epoch,
+    }
+
+
+async def ws_connect(host, port):
+    reader, writer = await asyncio.open_connection(host, port)
+    key = base64.b64encode(os.urandom(16)).decode()
+    writer.write(("GET / HTTP/1.1\r\nHost: %s:%d\r\nUpgrade: websocket\r\nConnection: Upgrade\r\n"
+                  "Sec-WebSocket-Key: %s\r\nSec-WebSocket-Version: 13\r\n\r\n" % (host, port, key)).encode())
+    status = await reader.readline()
+    if b" 101 " not in status:
+        raise ConnectionError("рукопожатие не принято: %r" % status)
+    while (await reader.readline()) not in (b"\r\n", b""):
+        pass
+    return reader, writer
+
+
+async def ws_send(writer, opcode, payload=b""):
+    # Кадры клиента обязаны быть замаскированы
+    mask = os.urandom(4)
+    masked = bytes(b ^ mask[i % 4] for i, b in enumerate(payload))
+    writer.write(bytes([0x80 | opcode, 0x80 | len(payload)]) + mask + masked)
+    await writer.drain()
+
+
+async def ws_frames(reader, writer):
+    while True:
+        head = await reader.readexactly(2)
+        opcode, length = head[0] & 0x0F, head[1] & 0x7F
+        if length == 126:
+            length = struct.unpack(">H", await reader.readexactly(2))[0]
+        elif length == 127:
+            length = struct.unpack(">Q", await reader.readexactly(8))[0]
+        payload = await reader.readexactly(length)
+        if opcode == 0x9:
+            await ws_send(writer, 0xA, payload)
+        elif opcode == 0x8:
+            return
+        elif opcode == 0x2:
+            yield payload
+
+
+async def run_client(host, port, arrivals, errors):
+    try:
+        reader, writer = await ws_connect(host, port)
+    except (OSError, ConnectionError) as e:
+        errors.append(str(e))
+        return
+    first = True
+    try:
+        async for payload in ws_frames(reader, writer):
+            received = time.monotonic()
+            frame = decode_frame(payload)
+            # Первый кадр приходит каждому клиенту отдельно при подключении
+            if first:
+                first = False
+                continue
+            arrivals.append((received, frame))
+    except (asyncio.IncompleteReadError, OSError) as e:
+        errors.append(str(e))
+    finally:
+        writer.close()
+
+
+def fetch_loop_stats(host, port):
+    with urllib.request.urlopen("http://%s:%d/loop-stats" % (host, port), timeout=5) as response:
+        return json.load(response)
+
+
+async def sample_heap(host, port, samples, stop):
+    while not stop.is_set():
+        try:
+            samples.append(await asyncio.to_thread(fetch_loop_stats, host, port))
+        except OSError:
+            pass
+        try:
+            await asyncio.wait_for(stop.wait(), 1.0)
+        except asyncio.TimeoutError:
+            pass
+
+
+def percentile(values, p):
+    ordered = sorted(values)
+    return ordered[min(len(ordered) - 1, int(p / 100.0 * len(ordered)))]
+
+
+async def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("host")
+    parser.add_argument("--port", type=int, default=81, help="порт WebSocket")
+    parser.add_argument("--http-port", type=int, default=80)
+    parser.add_argument("--clients", type=int, default=4)
+    parser.add_argument("--duration", type=float, default=60.0, help="секунды")
+    args = parser.parse_args()
+
+    baseline = fetch_loop_stats(args.host, args.http_port)
+    arrivals = [[] for _ in range(args.clients)]
+    errors = []
+    heap = []
+    stop = asyncio.Event()
+
+    sampler = asyncio.create_task(sample_heap(args.host, args.http_port, heap, stop))
+    clients = [asyncio.create_task(run_client(args.host, args.port, arrivals[i], errors))
+               for i in range(args.clients)]
+    await asyncio.sleep(args.duration)
+    stop.set()
+    for task in clients:
+        task.cancel()
+    await asyncio.gather(*clients, sampler, return_exceptions=True)
+
+    # Кадры рассылки одинаковы у всех клиентов и идут по порядку: n-й у каждого - один и тот же
+    delivered = min(len(a) for a in arrivals) if arrivals else 0
+    spreads = []
+    for n in range(delivered):
+        times = [a[n][0] for a in arrivals]
+        if len({a[n][1]["epoch"] for a in arrivals}) > 1:
+            errors.append("кадр %d различается у клиентов" % n)
+            continue
+        spreads.append((max(times) - min(times)) * 1000.0)
+
+    print("клиентов: %d, кадров на клиента: %d" % (args.clients, delivered))
+    if spreads:
+        print("разброс доставки, мс: медиана %.1f, p95 %.1f, максимум %.1f"
+              % (statistics.median(spreads), percentile(spreads, 95), max(spreads)))
+    if heap:
+        free = [s["freeHeap"] for s in heap]
+        print("куча до подключения: %d байт, во время теста: %d..%d байт, минимум с запуска: %d байт"
+              % (baseline["freeHeap"], min(free), max(free), heap[-1]["minFreeHeap"]))
+        print("loop(): максимум %d мкс за окно, пик с запуска %d мкс"
+              % (max(s["maxUs"] for s in heap), heap[-1]["peakUs"]))
+    for error in errors:
+        print("ошибка:", error)
+
+
+if __name__ == "__main__":
+    asyncio.run(main())
@@ -0,0 +1,120 @@
+// Минимальный SVG-график вместо Chart.js: линии, две оси Y, легенда и подсказка.
+// Работает без доступа в интернет (режим точки доступа).
+class LineChart {
+  constructor(container, series) {
+    this.container = container;
+    this.series = series; // [{ label, color, axis: 'left' | 'right', min, max }]
+    this.labels = [];
+    this.times = [];
+    this.data = series.map(() => []);
+    this.pad = { left: 48, right: 48, top: 28, bottom: 28 };
+    window.addEventListener('resize', () => this.update());
+  }
+
+  // times - epoch точек: по нему ставится ось X, чтобы пропуски в записи
+  // были видны. Без времени (или пока оно не синхронизировано) - по номеру.
+  setData(labels, data, times) {
+    this.labels = labels;
+    this.data = data;
+    this.times = times || [];
+    this.update();
+  }
+
+  range(axis) {
+    let min = Infinity, max = -Infinity;
+    this.series.forEach((s, i) => {
+      if (s.axis !== axis) return;
+      if (s.min !== undefined) min = Math.min(min, s.min);
+      if (s.max !== undefined) max = Math.max(max, s.max);
+      this.data[i].forEach(v => {
+        if (v === null || isNaN(v)) return;
+        min = Math.min(min, v);
+        max = Math.max(max, v);
+      });
+    });
+    if (!isFinite(min)) return [0, 1];
+    if (min === max) return [min - 1, max + 1];
+    return [min, max];
+  }
+
+  update() {
+    const w = this.container.clientWidth || 600;
+    const h = this.container.clientHeight || 300;
+    const p = this.pad;
+    const n = this.labels.length;
+    const plotW = w - p.left - p.right;
+    const plotH = h - p.top - p.bottom;
+    const timed = n > 1 && this.times.length === n && this.times.every(t => t > 0) && this.times[n - 1] > this.times[0];
+    const t0 = timed ? this.times[0] : 0;
+    const span = timed ? this.times[n - 1] - t0 : 0;
+    const x = i => p.left + (timed ? (this.times[i] - t0) * plotW / span : n > 1 ? i * plotW / (n - 1) : plotW / 2);
+    const ranges = { left: this.range('left'), right: this.range('right') };
+    const y = (axis, v) => {
+      const [lo, hi] = ranges[axis];
+      return p.top + plotH - (v - lo) * plotH / (hi - lo);
+    };
+
+    let svg = `<svg xmlns="http://www.w3.org/2000/svg" width="${w}" height="${h}" font-size="11" fill="#6c757d">`;
+
+    // Сетка и подписи осей
+    for (let t = 0; t <= 4; t++) {
+      const gy = p.top + plotH * t / 4;
+      svg += `<line x1="${p.left}" x2="${w - p.right}" y1="${gy}" y2="${gy}" stroke="#eee"/>`;
+      ['left', 'right'].forEach(axis => {
+        const [lo, hi] = ranges[axis];
+        const value = (hi - (hi - lo) * t / 4).toFixed(hi - lo < 10 ? 1 : 0);
+        const tx = axis === 'left' ? p.left - 6 : w - p.right + 6;
+        svg += `<text x="${tx}" y="${gy + 4}" text-anchor="${axis === 'left' ? 'end' : 'start'}">${value}</text>`;
+      });
+    }
+    const step = Math.max(1, Math.ceil(n / 6));
+    for (let i = 0; i < n; i += step) {
+      svg += `<text x="${x(i)}" y="${h - 8}" text-anchor="middle">${this.labels[i]}</text>`;
+    }
+
+    // Линии и легенда
+    this.series.forEach((s, i) => {
+      const points = [];
+      this.data[i].forEach((v, j) => {
+        if (v !== null && !isNaN(v)) points.push(x(j).toFixed(1) + ',' + y(s.axis, v).toFixed(1));
+      });
+      svg += `<polyline points="${points.join(' ')}" fill="none" stroke="${s.color}" stroke-width="2"/>`;
+      const lx = p.left + i * 160;
+      svg += `<rect x="${lx}" y="8" width="12" height="12" fill="${s.color}"/>`;
+      svg += `<text x="${lx + 16}" y="18">${s.label}</text>`;
+    });
+
+    svg += `<line class="cursor" y1="${p.top}" y2="${h - p.bottom}" stroke="#adb5bd" visibility="hidden"/>`;
+    svg += `<text class="tip" y="${p.top + 12}" fill="#212529" visibility="hidden"></text>`;
+    svg += '</svg>';
+    this.container.innerHTML = svg;
+
+    // Подсказка со значениями ближайшей точки
+    const root = this.container.firstChild;
+    const cursor = root.querySelector('.cursor');
+    const tip = root.querySelector('.tip');
+    root.onmousemove = e => {
+      if (n === 0) return;
+      const rect = root.getBoundingClientRect();
+      const mx = e.clientX - rect.left;
+      let i = Math.max(0, Math.min(n - 1, Math.round((mx - p.left) * (n - 1) / plotW)));
+      if (timed) {
+        // Ближайшая по горизонтали точка: по времени они расставлены неравномерно
+        i = 0;
+        for (let j = 1; j < n; j++) {
+          if (Math.abs(x(j) - mx) < Math.abs(x(i) - mx)) i = j;
+        }
+      }
+      cursor.setAttribute('x1', x(i));
+      cursor.setAttribute('x2', x(i));
+      cursor.setAttribute('visibility', 'visible');
+      tip.textContent = this.labels[i] + ': ' + this.series.map((s, k) => this.data[k][i] + ' ' + s.unit).join(', ');
+      tip.setAttribute('x', Math.min(x(i) + 6, w - p.right - 180));
+      tip.setAttribute('visibility', 'visible');
+    };
+    root.onmouseleave = () => {
+      cursor.setAttribute('visibility', 'hidden');
+      tip.setAttribute('visibility', 'hidden');
+    };
+  }
+}
@@ -0,0 +1,500 @@
+// Сгенерировано tools/build_web.py из каталога web/ - не редактировать вручную.
+#pragma once
+
+struct WebAsset {
+  const char *path;
+  const char *contentType;
+  const uint8_t *data;
+  size_t length;
+  const char *etag;
+  const char *cacheControl;
+};
+
+// style.css: 4274 байт, gzip 1342 байт
+const uint8_t STYLE_CSS_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xc5, 0x57, 0x4d, 0x6f, 0xe3, 0x36,
+  0x10, 0xbd, 0xfb, 0x57, 0x10, 0x08, 0x16, 0x6b, 0x2f, 0x44, 0x43, 0x92, 0x23, 0x7f, 0x5e, 0x7a,
+  0xed, 0xb5, 0x45, 0x0f, 0x3d, 0x52, 0x22, 0x69, 0xb1, 0x91, 0x45, 0x81, 0xa2, 0xe3, 0x4d, 0x17,
+  0xf9, 0xef, 0x1d, 0x92, 0x92, 0x45, 0xca, 0x52, 0x9a, 0xbd, 0xb4, 0x30, 0x60, 0x38, 0x13, 0xf2,
+  0x71, 0xe6, 0xcd, 0x9b, 0x19, 0xf2, 0xa8, 0xa4, 0xd4, 0xe8, 0xc7, 0x02, 0xe3, 0x46, 0x89, 0x0b,
+  0x51, 0x6f, 0x47, 0xf4, 0xf4, 0xbc, 0xd9, 0x26, 0x8c, 0x9d, 0xc0, 0xd6, 0xb2, 0x42, 0xd6, 0xd4,
+  0x59, 0x37, 0x7c, 0xb3, 0x2b, 0x0e, 0xc6, 0x4a, 0x8a, 0x82, 0xd5, 0xda, 0x2c, 0xdc, 0x1f, 0x32,
+  0xc6, 0x8d, 0x89, 0x92, 0xfa, 0xcc, 0x14, 0x98, 0xf8, 0x2e, 0xcd, 0xf6, 0x99, 0xdd, 0x7b, 0x85,
+  0x65, 0x6d, 0x6b, 0x96, 0x15, 0xc5, 0x81, 0xc7, 0xc6, 0x76, 0x23, 0xaa, 0x16, 0xf5, 0xd9, 0xac,
+  0xdb, 0x1f, 0xe0, 0x10, 0x63, 0xab, 0xc4, 0xb9, 0xd4, 0xd6, 0xc2, 0x0f, 0x9c, 0x38, 0x30, 0xf5,
+  0x02, 0x86, 0x34, 0x49, 0xb3, 0xd4, 0x1e, 0x78, 0x56, 0xc4, 0x78, 0xb0, 0x2d, 0x76, 0xd9, 0x8e,
+  0x9e, 0x16, 0xef, 0x8b, 0x6f, 0xe8, 0x07, 0xca, 0xe5, 0x77, 0xdc, 0x8a, 0xbf, 0x2d, 0x5c, 0x2e,
+  0x15, 0x65, 0x0a, 0x83, 0xe9, 0x84, 0x20, 0x88, 0xb3, 0xa8, 0x8f, 0x28, 0x3e, 0xa1, 0x86, 0x50,
+  0x6a, 0xff, 0x0f, 0xbf, 0xdf, 0x17, 0xb9, 0xa4, 0x6f, 0xb0, 0x8f, 0xcb, 0x5a, 0x63, 0x4e, 0x2e,
+  0xa2, 0x02, 0xcc, 0xf6, 0xad, 0xd5, 0xec, 0x82, 0xaf, 0x22, 0x42, 0x98, 0x34, 0x4d, 0xc5, 0xb0,
+  0xb3, 0x44, 0xe8, 0xeb, 0xef, 0xec, 0x2c, 0x19, 0xfa, 0xe3, 0xd7, 0xaf, 0x11, 0xfa, 0x4d, 0xe6,
+  0x52, 0xcb, 0x08, 0xb5, 0xa4, 0x6e, 0x81, 0x13, 0x25, 0xf8, 0x09, 0xe5, 0xa4, 0x78, 0x39, 0x2b,
+  0x79, 0xad, 0xe9, 0x11, 0x55, 0xa2, 0x66, 0x44, 0x19, 0x37, 0xa9, 0x00, 0x66, 0x96, 0xc9, 0x26,
+  0xa3, 0xec, 0x1c, 0x41, 0x4c, 0x19, 0xdf, 0x71, 0x82, 0xe2, 0x2f, 0xf0, 0xbb, 0xd8, 0x14, 0x9c,
+  0xa5, 0x28, 0x89, 0xe3, 0x2f, 0xab, 0x13, 0x2a, 0x64, 0x25, 0x81, 0xaf, 0x57, 0xa2, 0x96, 0x2e,
+  0x60, 0xb0, 0x5d, 0x44, 0x8d, 0x4b, 0xe6, 0xe8, 0x80, 0x65, 0xaf, 0xa5, 0xf1, 0x7a, 0x0d, 0x19,
+  0xd0, 0x04, 0x0e, 0x50, 0xe0, 0xfb, 0x85, 0x7c, 0xc7, 0x37, 0x41, 0x75, 0x09, 0x0b, 0xd2, 0x38,
+  0x6e, 0xfc, 0x70, 0x11, 0xb9, 0x6a, 0xe9, 0xc5, 0x9c, 0xda, 0x7f, 0xbf, 0x2f, 0x4a, 0x46, 0xa8,
+  0xdd, 0xac, 0xd9, 0x77, 0x8d, 0x09, 0xd0, 0x0d, 0xab, 0x4d, 0x02, 0x99, 0xf2, 0x56, 0x6f, 0x60,
+  0xb5, 0xa1, 0xc9, 0xc1, 0x01, 0x93, 0x5a, 0xcb, 0x8b, 0x33, 0x7b, 0x20, 0x65, 0xd2, 0x13, 0x08,
+  0xcc, 0x33, 0x38, 0x63, 0x9d, 0x29, 0x76, 0x79, 0xd8, 0x95, 0xd8, 0x5d, 0x41, 0x88, 0x9d, 0xba,
+  0x20, 0x4a, 0xbb, 0xfd, 0xd6, 0x85, 0xb9, 0x8b, 0x63, 0x0f, 0xbe, 0x09, 0xd1, 0x93, 0x75, 0x62,
+  0xd1, 0x03, 0x20, 0xa3, 0x85, 0x95, 0x25, 0x86, 0x92, 0xb6, 0xcc, 0x25, 0x51, 0x14, 0x76, 0x51,
+  0xd1, 0x36, 0x95, 0x11, 0xc9, 0x59, 0x09, 0x7a, 0xb2, 0xdf, 0x18, 0xd2, 0x08, 0x36, 0xcd, 0x30,
+  0xec, 0xbf, 0x5e, 0x6a, 0x50, 0xa2, 0x62, 0x0d, 0x23, 0x7a, 0x69, 0x88, 0xc2, 0x5c, 0xe8, 0xc8,
+  0x30, 0x0e, 0x94, 0x2e, 0xd3, 0x3d, 0x38, 0x1c, 0xa1, 0x84, 0xab, 0x15, 0x40, 0x9f, 0x49, 0xd3,
+  0xb3, 0x37, 0xc3, 0xc6, 0xba, 0x70, 0xa7, 0xfa, 0x1a, 0xb8, 0x95, 0x42, 0xb3, 0x53, 0xaf, 0x44,
+  0xa3, 0x84, 0x2b, 0x9c, 0x98, 0x64, 0x66, 0xc7, 0x90, 0x13, 0xfb, 0xa7, 0x55, 0x6e, 0x49, 0xa8,
+  0xbc, 0x99, 0xb4, 0x19, 0xb2, 0xec, 0x71, 0x48, 0x9d, 0x73, 0xb2, 0x8c, 0x23, 0xfb, 0x59, 0x27,
+  0xe0, 0x89, 0x56, 0x20, 0x38, 0xa1, 0x85, 0x84, 0x8c, 0xd9, 0xdf, 0x5c, 0xaa, 0x0b, 0x8a, 0xd7,
+  0x9b, 0x36, 0xf2, 0x40, 0xac, 0xe1, 0xee, 0xd6, 0xb1, 0x94, 0xaf, 0x2e, 0xdd, 0xfd, 0x86, 0x6e,
+  0xaf, 0xa1, 0xe2, 0xcf, 0x25, 0x06, 0x0f, 0x56, 0x0f, 0x2e, 0x80, 0xd1, 0x29, 0x20, 0x74, 0x21,
+  0x5b, 0xdd, 0x61, 0xf1, 0x5d, 0x46, 0x77, 0xaa, 0x79, 0xc5, 0x20, 0x18, 0x2b, 0x28, 0x0c, 0xb1,
+  0x5f, 0xda, 0x41, 0x56, 0x23, 0xde, 0x1c, 0x99, 0x1d, 0x0b, 0x83, 0x4a, 0x3a, 0x32, 0xba, 0xd2,
+  0xed, 0x8c, 0xe0, 0x44, 0x2b, 0x2b, 0x41, 0x43, 0x57, 0xe2, 0x09, 0x57, 0xd6, 0x02, 0x4a, 0x63,
+  0xac, 0x98, 0xbd, 0xaf, 0x47, 0xd5, 0xd5, 0x52, 0xf6, 0x20, 0x47, 0xd7, 0xc2, 0x1e, 0x31, 0xcb,
+  0x74, 0x0c, 0xb8, 0xb1, 0x80, 0x81, 0x68, 0xb7, 0x46, 0xb4, 0x33, 0xea, 0xee, 0xf1, 0xba, 0x66,
+  0x33, 0x22, 0xcb, 0x7c, 0x63, 0x2a, 0x14, 0x2b, 0x5c, 0x52, 0x9d, 0x32, 0x87, 0x5d, 0xaf, 0xa4,
+  0xba, 0xb2, 0xe9, 0x12, 0x7b, 0x2c, 0x9b, 0xbe, 0xf2, 0x93, 0xae, 0x74, 0x03, 0x8f, 0xee, 0x9d,
+  0xdb, 0xf3, 0xa9, 0xd5, 0x44, 0x5f, 0x5b, 0xdf, 0x2b, 0x51, 0x9b, 0xd6, 0x85, 0xf3, 0x4a, 0x16,
+  0x2f, 0x9e, 0x4c, 0xf7, 0x00, 0x18, 0x64, 0xa7, 0x97, 0xb3, 0x4b, 0xe4, 0x2c, 0x19, 0x5d, 0x0d,
+  0x74, 0xec, 0x6b, 0xd9, 0xf4, 0xad, 0x00, 0x3c, 0x70, 0x87, 0x03, 0x92, 0xa8, 0x47, 0x95, 0x33,
+  0xee, 0x9e, 0x5a, 0x22, 0x9b, 0xb8, 0x28, 0xcc, 0x55, 0x34, 0xe2, 0x7a, 0xe5, 0xc3, 0x52, 0xf5,
+  0xf6, 0x93, 0xa8, 0xdd, 0x28, 0xba, 0xc3, 0xba, 0x09, 0xb6, 0xf2, 0xe8, 0xa2, 0xac, 0x2d, 0x94,
+  0x68, 0x4c, 0xa6, 0x00, 0x7b, 0xaa, 0x09, 0x79, 0x69, 0x8a, 0xd7, 0x07, 0x5f, 0x79, 0x36, 0xf6,
+  0xac, 0xef, 0x16, 0xb0, 0x4c, 0xc9, 0xaa, 0xfd, 0x1f, 0xfa, 0x94, 0x3b, 0x19, 0x37, 0xa4, 0x66,
+  0xd5, 0x7f, 0xd0, 0xb0, 0x1e, 0x8e, 0x2c, 0x37, 0xd3, 0xf5, 0x34, 0xd9, 0x20, 0x3e, 0x33, 0x30,
+  0xb6, 0x6e, 0x60, 0xac, 0x4d, 0x63, 0xc3, 0x26, 0x94, 0xc6, 0x8e, 0xc5, 0x70, 0xfc, 0xf4, 0xc4,
+  0x7b, 0x8b, 0x2a, 0x92, 0x5b, 0x06, 0xee, 0x09, 0xe8, 0x34, 0x3f, 0xda, 0xba, 0xff, 0x50, 0xdf,
+  0xc1, 0xb4, 0xee, 0xf1, 0xbb, 0x80, 0x01, 0xbb, 0x9f, 0xcc, 0x30, 0xe1, 0x3d, 0x0a, 0x93, 0x74,
+  0x54, 0x4d, 0x7e, 0x93, 0x7b, 0xa2, 0x94, 0x3e, 0xe4, 0x60, 0x70, 0xa2, 0x23, 0xcd, 0x52, 0xe6,
+  0x0f, 0x03, 0xb7, 0x61, 0x68, 0xfc, 0xbe, 0x23, 0x47, 0x2e, 0x0b, 0x5b, 0xe5, 0xf2, 0xaa, 0x4d,
+  0x11, 0x1c, 0x51, 0x2d, 0xeb, 0x21, 0xd1, 0xb3, 0x6d, 0x30, 0xd7, 0xf5, 0x27, 0x5a, 0x83, 0x8d,
+  0xa6, 0x53, 0x85, 0x27, 0xa6, 0x71, 0xce, 0xc2, 0x86, 0xd0, 0xc7, 0x1d, 0x38, 0xf2, 0x71, 0xb4,
+  0x13, 0x39, 0xb8, 0xaa, 0xd6, 0x60, 0x36, 0x52, 0xb8, 0x21, 0x13, 0x10, 0x72, 0xf7, 0xa5, 0x1b,
+  0x8f, 0xfe, 0xb8, 0x4c, 0x81, 0xa4, 0xa9, 0xcb, 0x8f, 0x0b, 0xfa, 0x3e, 0x30, 0x1f, 0xe3, 0xf1,
+  0x9b, 0xe8, 0xcc, 0x38, 0x4d, 0xed, 0x38, 0x75, 0x48, 0x8e, 0xac, 0x09, 0x91, 0x05, 0xc2, 0xe8,
+  0xd6, 0xba, 0x7e, 0x33, 0x79, 0x6c, 0xd7, 0x8a, 0x46, 0x4b, 0x27, 0xfd, 0x7c, 0xa2, 0x49, 0xf2,
+  0xfc, 0x4c, 0xec, 0x52, 0x51, 0x73, 0x89, 0x73, 0x32, 0x31, 0xa3, 0xff, 0xba, 0xb6, 0x5a, 0xf0,
+  0x37, 0xab, 0x10, 0x7b, 0x73, 0x6f, 0x1b, 0x52, 0x40, 0x6e, 0x99, 0xbe, 0x31, 0x56, 0x9f, 0xa6,
+  0xda, 0xc2, 0x90, 0xf0, 0x6c, 0x48, 0xf8, 0xa8, 0x55, 0x4c, 0xb5, 0x1e, 0x57, 0xc9, 0x61, 0xc3,
+  0xc8, 0xba, 0x02, 0x98, 0x1e, 0xe9, 0xd6, 0x6d, 0x73, 0x7f, 0xf8, 0xe4, 0xdd, 0x22, 0xd8, 0xd2,
+  0xdf, 0x01, 0xc2, 0x81, 0xbf, 0xff, 0x70, 0xde, 0x93, 0x8a, 0x29, 0x78, 0xf2, 0x84, 0x21, 0xfe,
+  0x54, 0x74, 0x7e, 0x02, 0x38, 0xe7, 0x9b, 0x82, 0xde, 0x8f, 0x7b, 0xda, 0x67, 0xdb, 0xe7, 0xf8,
+  0xf9, 0x0e, 0x57, 0x31, 0xae, 0xed, 0x24, 0xe8, 0x0b, 0x9e, 0x73, 0xc6, 0x72, 0x32, 0x38, 0xd2,
+  0x0f, 0xa2, 0x71, 0x62, 0x3f, 0x81, 0xdb, 0xd7, 0xf2, 0x23, 0xe6, 0xa4, 0xb8, 0xe0, 0x85, 0x45,
+  0x77, 0x94, 0x0c, 0x90, 0xbb, 0x34, 0x29, 0xd2, 0x39, 0xc8, 0xac, 0xd8, 0x16, 0xb9, 0x85, 0x2c,
+  0x05, 0xa5, 0x2c, 0xe8, 0x0d, 0xae, 0x8e, 0xdf, 0x17, 0x9a, 0xe4, 0x15, 0x1b, 0x37, 0xbe, 0xa1,
+  0xcf, 0x54, 0xa4, 0x69, 0x99, 0xbd, 0xe4, 0xd8, 0x5f, 0xa7, 0xb9, 0x3e, 0xad, 0x4b, 0xa8, 0x57,
+  0x1a, 0x64, 0xc4, 0xf2, 0xec, 0xd7, 0xac, 0x71, 0xee, 0x83, 0xcb, 0xa2, 0xeb, 0xa3, 0x00, 0xa5,
+  0x8e, 0xb5, 0x2e, 0x71, 0x51, 0x8a, 0x8a, 0x2e, 0xd9, 0x2b, 0xab, 0x57, 0x01, 0x09, 0x43, 0x78,
+  0x07, 0xf3, 0x71, 0x03, 0xab, 0x24, 0x4a, 0x63, 0xff, 0x95, 0xd5, 0xbf, 0xc1, 0x36, 0xf1, 0xbc,
+  0x06, 0x2c, 0x2f, 0xad, 0x96, 0xea, 0x0d, 0x8f, 0x1f, 0x68, 0xa3, 0xed, 0xa6, 0x6a, 0x79, 0x25,
+  0x6f, 0x18, 0x88, 0x73, 0x4f, 0xb4, 0x19, 0x1a, 0x38, 0xbc, 0xc4, 0xff, 0xfd, 0xa1, 0x96, 0x4e,
+  0xdd, 0xf6, 0xe6, 0xef, 0x23, 0xef, 0x8b, 0x5f, 0x2e, 0x8c, 0x0a, 0x82, 0x96, 0xde, 0xdb, 0x71,
+  0xb7, 0x85, 0x0a, 0x31, 0xcc, 0x0c, 0x6f, 0xa8, 0x08, 0xf9, 0xd7, 0x94, 0x99, 0x7b, 0x09, 0x5c,
+  0x3c, 0x00, 0x11, 0xf9, 0x9d, 0x66, 0xee, 0x46, 0x6b, 0x2f, 0x27, 0xdd, 0xe5, 0xcf, 0x73, 0xa2,
+  0x6b, 0xde, 0x66, 0x1d, 0x51, 0x2d, 0xb3, 0x3e, 0xb8, 0xc1, 0x13, 0x36, 0x1c, 0x77, 0x83, 0xf1,
+  0x1f, 0xc4, 0x59, 0x8f, 0xf5, 0x0f, 0xba, 0x37, 0x2a, 0xdd, 0xb2, 0x10, 0x00, 0x00
+};
+
+// chart.js: 4709 байт, gzip 2078 байт
+const uint8_t CHART_JS_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x8d, 0x57, 0x5b, 0x6f, 0x1b, 0xc7,
+  0x15, 0x7e, 0xd7, 0xaf, 0x18, 0xd3, 0x46, 0x76, 0x37, 0x22, 0x97, 0x97, 0xd8, 0x8a, 0x2a, 0x89,
+  0x32, 0x52, 0x37, 0xa9, 0x0b, 0x38, 0x79, 0x68, 0x8a, 0x26, 0x85, 0x20, 0x20, 0x2b, 0x72, 0xc4,
+  0x1d, 0x79, 0xb9, 0xcb, 0xee, 0x0e, 0x2f, 0xaa, 0x2c, 0xc0, 0x97, 0x16, 0x2e, 0x90, 0x00, 0x41,
+  0x9e, 0x5b, 0xa0, 0xed, 0x3f, 0x50, 0xec, 0x28, 0xa6, 0x2f, 0x52, 0xfe, 0xc2, 0xf2, 0x1f, 0xf5,
+  0x3b, 0x67, 0xf6, 0x46, 0x99, 0x86, 0xf3, 0x40, 0xee, 0xee, 0x9c, 0xfb, 0x9c, 0x73, 0xbe, 0x39,
+  0xd3, 0x6c, 0x8a, 0xf4, 0xdf, 0xe9, 0x3c, 0xbd, 0xc0, 0xef, 0x4d, 0x7a, 0x96, 0xbe, 0x5e, 0x7c,
+  0x97, 0x5e, 0x2c, 0xbe, 0x4d, 0x5f, 0x8a, 0x2f, 0xff, 0xfc, 0xfb, 0x46, 0xfa, 0x7c, 0xf1, 0x30,
+  0x3d, 0x5b, 0xfc, 0x1d, 0xc4, 0x57, 0x22, 0x7d, 0x06, 0x8e, 0xf3, 0xc5, 0xa3, 0xc5, 0xe3, 0xf4,
+  0x52, 0xdc, 0xf1, 0xbd, 0x58, 0xbb, 0x47, 0xc9, 0x96, 0x48, 0x5f, 0x67, 0xe2, 0xf3, 0xba, 0x48,
+  0x7f, 0x02, 0xd3, 0xb9, 0x48, 0x2f, 0x17, 0x8f, 0xd2, 0xb9, 0xf8, 0x4b, 0x9d, 0x88, 0xe7, 0xe9,
+  0x73, 0xfc, 0x2e, 0x40, 0x3a, 0x13, 0x58, 0x4c, 0x7f, 0x49, 0x2f, 0xd3, 0x9f, 0x40, 0x7f, 0x05,
+  0x6b, 0x2f, 0xe8, 0xdf, 0x5d, 0x6b, 0xc2, 0x89, 0xff, 0xe2, 0xf3, 0x47, 0x08, 0x3e, 0xc6, 0xf3,
+  0x7c, 0xf1, 0x58, 0xe0, 0xe3, 0x3c, 0x7d, 0x41, 0x1a, 0x2f, 0xc9, 0xe4, 0xe2, 0x09, 0x04, 0xa1,
+  0xe0, 0x99, 0x20, 0x6b, 0xe0, 0x3a, 0x87, 0x67, 0x17, 0xcc, 0x69, 0xe3, 0xed, 0x3c, 0xfd, 0x99,
+  0x02, 0x10, 0xe4, 0xdb, 0xe2, 0x29, 0xb4, 0xce, 0xaf, 0x48, 0x3a, 0xee, 0x5a, 0x2f, 0xf0, 0x92,
+  0x44, 0xdc, 0x53, 0xa1, 0x64, 0xe7, 0xc5, 0xc9, 0x5a, 0x2f, 0x0a, 0x13, 0x1d, 0x8f, 0x7b, 0x3a,
+  0x8a, 0x6d, 0xbc, 0x6b, 0x0f, 0xb4, 0xb8, 0x2e, 0x12, 0x19, 0x2b, 0x99, 0x38, 0x60, 0xd0, 0xbe,
+  0x4a, 0xdc, 0x82, 0x22, 0xba, 0xa2, 0x78, 0xdf, 0x36, 0x34, 0xc3, 0x0a, 0x82, 0x79, 0xd9, 0x16,
+  0x08, 0x65, 0xef, 0x44, 0x04, 0xde, 0x81, 0x0c, 0xea, 0xe0, 0x0e, 0x22, 0xe8, 0xf3, 0x66, 0x0a,
+  0xfb, 0x64, 0x05, 0xf2, 0x50, 0x5b, 0xe2, 0x81, 0xb0, 0x62, 0x35, 0xf0, 0xb5, 0x55, 0x17, 0x43,
+  0x15, 0xe2, 0xcf, 0x9b, 0x89, 0xd3, 0x7d, 0xa3, 0x8d, 0xc5, 0x48, 0xdb, 0xde, 0x7e, 0xa6, 0x5f,
+  0xab, 0xa1, 0x5c, 0x5a, 0xe8, 0x7b, 0xda, 0x2b, 0xcc, 0xb9, 0x43, 0x6f, 0x64, 0xdb, 0x8e, 0xe8,
+  0xee, 0x82, 0xc1, 0xc9, 0x38, 0x46, 0x5e, 0x1f, 0x0c, 0xf0, 0x01, 0xe6, 0xb6, 0xc4, 0xcd, 0xcd,
+  0xba, 0x60, 0x7b, 0xe6, 0x55, 0x47, 0xa3, 0x2d, 0xd1, 0xc1, 0xcb, 0x41, 0xa4, 0x75, 0x34, 0xa4,
+  0x77, 0x71, 0xba, 0xbd, 0x36, 0x55, 0x61, 0x3f, 0x9a, 0xba, 0x5e, 0xbf, 0xff, 0xe9, 0x44, 0x86,
+  0xfa, 0x9e, 0x4a, 0xb4, 0x44, 0x90, 0xb6, 0x15, 0xcb, 0x44, 0xfd, 0x4d, 0xc2, 0x57, 0x63, 0x85,
+  0x0d, 0x8c, 0x47, 0x70, 0x42, 0xda, 0x0e, 0x0c, 0x9e, 0x52, 0xea, 0x8c, 0x8f, 0x0d, 0x21, 0x47,
+  0x51, 0xcf, 0xcf, 0x33, 0x70, 0x9e, 0xbe, 0xda, 0xe2, 0x5c, 0x0b, 0xca, 0x52, 0xfa, 0x66, 0xf1,
+  0x44, 0x70, 0xe5, 0x9c, 0xa1, 0x40, 0xe6, 0x48, 0xca, 0xa3, 0xc5, 0xf7, 0x5c, 0x26, 0x8b, 0xef,
+  0xc4, 0xd7, 0x75, 0xb1, 0x78, 0x4a, 0x62, 0xe9, 0x8f, 0x8b, 0x6f, 0x21, 0x83, 0x74, 0x5e, 0xe2,
+  0xff, 0x09, 0xd7, 0xc8, 0x9c, 0x53, 0xfe, 0x02, 0x72, 0xbf, 0x40, 0x0e, 0x55, 0xc5, 0xc5, 0x02,
+  0x46, 0x2a, 0x3b, 0x2a, 0xc9, 0x39, 0xf2, 0x8c, 0x82, 0x75, 0x45, 0xfa, 0x83, 0x29, 0x98, 0x67,
+  0x5c, 0x0e, 0x6f, 0xb8, 0xe6, 0xe6, 0xc2, 0x06, 0xc3, 0xeb, 0xbc, 0xec, 0x5e, 0x51, 0x05, 0x5d,
+  0x62, 0xdd, 0x78, 0x25, 0x48, 0x1f, 0x84, 0xff, 0xc1, 0x16, 0xa9, 0x84, 0x5f, 0xc0, 0x06, 0xbd,
+  0x3f, 0x83, 0x3d, 0x70, 0x39, 0x88, 0x2a, 0x8f, 0xe1, 0x92, 0x8b, 0xff, 0xe1, 0xe2, 0x89, 0xbb,
+  0x96, 0x48, 0xfd, 0x3b, 0xa4, 0xc1, 0x36, 0xe9, 0xaa, 0x0b, 0xca, 0x49, 0xdd, 0x6c, 0x43, 0x51,
+  0x34, 0x45, 0x2a, 0xcd, 0xcb, 0x72, 0xf6, 0xe8, 0x71, 0x25, 0xc1, 0xe6, 0xf9, 0xe0, 0x41, 0x99,
+  0xe9, 0x7c, 0x9b, 0x69, 0x97, 0x63, 0x2f, 0x1c, 0x48, 0x9b, 0xea, 0x88, 0x0c, 0x04, 0x52, 0x53,
+  0xed, 0x40, 0xea, 0x0f, 0xe1, 0xa1, 0x0a, 0x95, 0x3e, 0x36, 0x65, 0xd4, 0x15, 0x8d, 0x7c, 0x61,
+  0xa9, 0x3c, 0xdd, 0xc3, 0x28, 0xfe, 0xd4, 0xeb, 0xf9, 0xb6, 0x0d, 0x67, 0x15, 0x27, 0xf2, 0x64,
+  0x4d, 0x1d, 0x0a, 0x3b, 0x71, 0x49, 0xa5, 0xb8, 0xd6, 0xed, 0x0a, 0xa3, 0x3b, 0x96, 0x7a, 0x1c,
+  0x87, 0xdb, 0x19, 0x91, 0x6c, 0x10, 0x6d, 0x1c, 0xf6, 0x25, 0xd4, 0xca, 0xbe, 0x93, 0x99, 0xfd,
+  0xdc, 0xd3, 0x3e, 0x51, 0x6d, 0xae, 0x60, 0x66, 0x74, 0x0a, 0x21, 0x38, 0x72, 0x55, 0x88, 0x7d,
+  0x33, 0x42, 0xde, 0xcc, 0xc6, 0x8f, 0x85, 0xbc, 0x99, 0x53, 0xd9, 0x96, 0x3d, 0xb5, 0x5f, 0xf8,
+  0x39, 0x29, 0x5d, 0xc4, 0x2b, 0x94, 0x85, 0xe3, 0x20, 0xa0, 0xcd, 0x51, 0xc9, 0x17, 0xde, 0x17,
+  0xf6, 0xc4, 0x29, 0x3d, 0x5d, 0xe5, 0xd0, 0x04, 0x7a, 0x57, 0xd9, 0xa4, 0xf5, 0xd3, 0xec, 0x47,
+  0xba, 0xaf, 0xa9, 0xe4, 0x33, 0xda, 0x2d, 0x49, 0x62, 0x85, 0x4e, 0xb1, 0xd7, 0xaa, 0x8b, 0xf6,
+  0xbe, 0x61, 0x61, 0xf5, 0x70, 0x80, 0x9c, 0x2d, 0xe8, 0xb4, 0xd8, 0x10, 0x6d, 0xb3, 0xe9, 0xeb,
+  0xcc, 0x5b, 0x21, 0xf1, 0xf2, 0x3e, 0x65, 0x2d, 0xcf, 0x60, 0x8e, 0x34, 0x62, 0x4a, 0x89, 0x5e,
+  0x82, 0x14, 0xb7, 0x17, 0x28, 0x34, 0xdc, 0x57, 0xaa, 0xaf, 0x7d, 0x0a, 0x70, 0xa3, 0xd5, 0xda,
+  0xce, 0x98, 0xfd, 0x77, 0x31, 0xdf, 0x95, 0xd4, 0xcf, 0xc4, 0xfd, 0x51, 0xc9, 0x3d, 0xca, 0xb9,
+  0xd1, 0xfe, 0xf9, 0x5a, 0x98, 0xaf, 0x99, 0x1a, 0x74, 0x03, 0x19, 0x0e, 0xb4, 0x5f, 0x48, 0x04,
+  0x91, 0xfe, 0x0a, 0x1c, 0x53, 0xc4, 0x32, 0x72, 0x09, 0x2d, 0xf8, 0x85, 0xc1, 0xa2, 0xca, 0x73,
+  0x17, 0x3c, 0x3e, 0x93, 0x00, 0x1e, 0xfc, 0x34, 0xd8, 0x91, 0xf3, 0x50, 0xe5, 0x12, 0xe2, 0x84,
+  0x62, 0x57, 0xb4, 0xc5, 0x07, 0x1f, 0x88, 0xb2, 0xae, 0x33, 0x8b, 0x26, 0x85, 0x57, 0x48, 0x72,
+  0x22, 0xe3, 0x63, 0x5b, 0x33, 0xaa, 0x40, 0xb2, 0xe5, 0x2c, 0xd3, 0xf7, 0x78, 0x8b, 0xf7, 0xc5,
+  0x6e, 0x75, 0xad, 0xb5, 0x5f, 0x18, 0x6d, 0x65, 0x3d, 0xd3, 0x17, 0xb7, 0x97, 0x39, 0xc4, 0x96,
+  0x28, 0x36, 0x25, 0x19, 0x79, 0xe1, 0x6a, 0xbe, 0x4c, 0x7b, 0x83, 0x14, 0x55, 0x04, 0xa8, 0x66,
+  0x14, 0xb9, 0x94, 0x6d, 0xc8, 0xba, 0xb0, 0x73, 0x61, 0xbb, 0x22, 0xad, 0x8c, 0xa4, 0x23, 0x3e,
+  0xcc, 0x76, 0xb1, 0x69, 0x4c, 0x6d, 0x65, 0x9b, 0x70, 0x1b, 0x4a, 0x4a, 0x92, 0xcd, 0xc6, 0x1c,
+  0x50, 0xf3, 0x95, 0x8e, 0x93, 0x1b, 0xe4, 0xc6, 0x4e, 0x2a, 0x78, 0xcd, 0x56, 0x4c, 0xbb, 0x9b,
+  0x03, 0xc3, 0x29, 0xf0, 0xbb, 0x4a, 0x32, 0x47, 0x88, 0x43, 0xd8, 0x6d, 0x14, 0x1d, 0x43, 0x07,
+  0x03, 0x04, 0x95, 0xb9, 0x69, 0x1f, 0x43, 0xd8, 0x0b, 0xa2, 0xba, 0xf0, 0xe1, 0x71, 0x37, 0x33,
+  0xb6, 0x47, 0x5c, 0x65, 0xc9, 0x9a, 0xb4, 0xae, 0x67, 0xa9, 0x6e, 0x50, 0xc7, 0x35, 0x44, 0x10,
+  0xe5, 0xb1, 0xdd, 0xa5, 0x00, 0x7c, 0x65, 0xd6, 0x50, 0xd4, 0xdb, 0x8c, 0x3e, 0xc9, 0x64, 0x00,
+  0x7d, 0xdf, 0xec, 0xd0, 0x73, 0x36, 0x0c, 0xc2, 0xa4, 0x5b, 0xf3, 0xb5, 0x1e, 0x6d, 0x35, 0x9b,
+  0xd3, 0xe9, 0xd4, 0x9d, 0x7e, 0xe4, 0x46, 0xf1, 0xa0, 0xd9, 0x69, 0xb5, 0x5a, 0x4d, 0x70, 0xd4,
+  0xc4, 0x94, 0xca, 0xbb, 0x5b, 0xbb, 0x71, 0x32, 0x3d, 0xad, 0x09, 0x9f, 0xcb, 0x97, 0xbe, 0x7c,
+  0x7c, 0x1d, 0xa2, 0xb8, 0x1b, 0x74, 0xc6, 0x74, 0x6b, 0xed, 0x36, 0x3e, 0x55, 0x10, 0x74, 0x6b,
+  0xd7, 0x37, 0x7a, 0x1f, 0xdf, 0xfa, 0xb8, 0x5f, 0xdb, 0xfd, 0x66, 0x9b, 0xe1, 0xfe, 0x7f, 0x74,
+  0xce, 0x1b, 0xf4, 0xce, 0x07, 0x88, 0xfc, 0x38, 0x30, 0xb3, 0xc6, 0x79, 0xfa, 0x72, 0x0d, 0xe0,
+  0x21, 0x6c, 0x72, 0x0e, 0x35, 0x85, 0x8c, 0xe2, 0xb1, 0xd3, 0x15, 0x37, 0xf1, 0x5c, 0x5f, 0x2f,
+  0x3b, 0x70, 0x40, 0xfb, 0xb4, 0x1c, 0xf2, 0x87, 0xe0, 0x6c, 0x82, 0x71, 0x8d, 0x82, 0x59, 0xa7,
+  0xa8, 0x02, 0x34, 0x9b, 0x98, 0xb5, 0xc9, 0x45, 0x53, 0x07, 0xf0, 0x73, 0xd6, 0x61, 0xff, 0xcb,
+  0x16, 0xc1, 0xda, 0x31, 0xb3, 0x0c, 0x8e, 0xe9, 0xb5, 0x53, 0xbc, 0x62, 0xa2, 0x88, 0xee, 0x23,
+  0x9c, 0xeb, 0x52, 0xca, 0x5a, 0x93, 0x42, 0xd8, 0x33, 0x99, 0xac, 0xe7, 0x27, 0x7f, 0x09, 0x74,
+  0x0c, 0xbf, 0xbf, 0x26, 0x59, 0x86, 0x3c, 0xf1, 0x82, 0xb1, 0xa4, 0x44, 0x73, 0x42, 0x8a, 0xb4,
+  0xe4, 0x21, 0x38, 0x88, 0xeb, 0x33, 0x35, 0x93, 0xfd, 0x9c, 0x22, 0x76, 0x44, 0xbb, 0x85, 0x6a,
+  0x6c, 0x53, 0x8d, 0x17, 0x35, 0xa7, 0xa9, 0xca, 0x8d, 0x65, 0xf4, 0x65, 0x36, 0x96, 0xdc, 0x2e,
+  0x31, 0x60, 0x03, 0xdc, 0x95, 0x40, 0xb1, 0x51, 0x1b, 0x95, 0xcd, 0xd1, 0x72, 0x86, 0x3e, 0xa1,
+  0x68, 0xf5, 0x8c, 0x02, 0x37, 0x71, 0x83, 0xe9, 0x26, 0xbe, 0x88, 0xd8, 0xf0, 0xc2, 0x9e, 0x1f,
+  0xc5, 0xb4, 0xfe, 0xb6, 0x11, 0x4b, 0x86, 0x7d, 0x0b, 0xfa, 0xad, 0x44, 0x63, 0x04, 0xb3, 0x4e,
+  0x6b, 0xbb, 0x37, 0x4e, 0x38, 0xaa, 0xd3, 0x9d, 0x26, 0x09, 0xd3, 0x76, 0x31, 0x44, 0xe7, 0x1d,
+  0xac, 0xe5, 0xa8, 0x8a, 0xe3, 0x00, 0x5d, 0x7e, 0xef, 0x49, 0x15, 0xa0, 0xaf, 0x9a, 0x62, 0x83,
+  0xc6, 0x90, 0x22, 0xf5, 0xca, 0xa4, 0x5e, 0x21, 0xf0, 0x90, 0x1e, 0xf0, 0x98, 0x34, 0x50, 0xfe,
+  0x57, 0x04, 0x30, 0xb3, 0x95, 0x93, 0x87, 0x40, 0x08, 0xb7, 0x79, 0x35, 0x82, 0xa1, 0xea, 0xf7,
+  0x03, 0x49, 0x3e, 0x56, 0x60, 0x14, 0xdd, 0x5f, 0x75, 0x96, 0x0b, 0xf4, 0x5f, 0xf9, 0x08, 0xcc,
+  0x05, 0xba, 0x34, 0xf3, 0xbe, 0xf7, 0x20, 0xce, 0x90, 0x36, 0x52, 0xa1, 0x7e, 0x6b, 0xd2, 0xab,
+  0x1e, 0x8a, 0xf6, 0xa4, 0x2e, 0x8e, 0x9c, 0xea, 0xc9, 0x78, 0x2d, 0x3f, 0x19, 0x81, 0x9c, 0xd7,
+  0xca, 0xa3, 0xd1, 0xa8, 0x72, 0x47, 0xe3, 0xc4, 0xb7, 0x67, 0xf6, 0x51, 0x59, 0x15, 0xc0, 0xa0,
+  0x75, 0x61, 0xd5, 0x2d, 0xfc, 0x1f, 0x67, 0x67, 0x3f, 0xa1, 0x45, 0x85, 0x9e, 0x1d, 0x8e, 0xc5,
+  0x5e, 0x8d, 0xa2, 0xe0, 0x98, 0xbb, 0xc1, 0xe8, 0xe4, 0x8e, 0x30, 0xda, 0x8f, 0xf0, 0xb0, 0x2d,
+  0x61, 0xd1, 0x06, 0x9a, 0xa6, 0x0d, 0xa3, 0x50, 0x96, 0xd5, 0x7f, 0xe3, 0x84, 0x0e, 0x2e, 0x8c,
+  0xbf, 0x45, 0x47, 0x34, 0x32, 0x14, 0xe8, 0x98, 0xa6, 0x30, 0x61, 0x07, 0x33, 0xee, 0xc7, 0x0c,
+  0x6c, 0x09, 0x35, 0xdb, 0x1b, 0xad, 0x8a, 0x03, 0xb1, 0xec, 0x65, 0xc9, 0x0a, 0xb2, 0x6a, 0xdb,
+  0x2c, 0xe0, 0xa4, 0xdd, 0x29, 0xc1, 0x84, 0xde, 0x8d, 0x1b, 0x15, 0xc3, 0x6c, 0x67, 0x45, 0xde,
+  0x03, 0x3e, 0xb5, 0x37, 0x8c, 0xbe, 0xf6, 0x26, 0xe5, 0x37, 0x4b, 0xee, 0x95, 0x2a, 0x5c, 0x46,
+  0x04, 0xbe, 0x3f, 0x74, 0x6b, 0xbd, 0x71, 0x9c, 0x44, 0x71, 0xde, 0xfd, 0x8c, 0x25, 0x05, 0x00,
+  0xf8, 0x95, 0xf3, 0xb1, 0x0a, 0x05, 0x5e, 0xff, 0xe0, 0xd6, 0x41, 0xbf, 0x26, 0x26, 0x2a, 0x51,
+  0x07, 0x2a, 0xc0, 0x80, 0x06, 0xc0, 0x44, 0x71, 0xc9, 0x70, 0x95, 0x93, 0x99, 0x21, 0xad, 0x46,
+  0x59, 0x71, 0xe6, 0x80, 0xd5, 0xee, 0x14, 0xbb, 0x7d, 0xbd, 0xd3, 0xee, 0xdc, 0xea, 0xfc, 0x66,
+  0xa5, 0xca, 0xdd, 0x32, 0x8a, 0x4c, 0xb1, 0xb5, 0x43, 0x40, 0xbc, 0x6b, 0x6d, 0x5f, 0xb9, 0xd1,
+  0xb8, 0x2a, 0xc4, 0xff, 0xdd, 0x3f, 0x7d, 0x7e, 0x8f, 0xee, 0x14, 0x93, 0x81, 0x81, 0xdb, 0xff,
+  0x5c, 0xbd, 0xa1, 0xd1, 0xa0, 0x7c, 0x49, 0x53, 0xf8, 0x05, 0x2e, 0x83, 0x4f, 0xcd, 0x64, 0xbd,
+  0xf8, 0x1e, 0x03, 0xf1, 0x9c, 0xae, 0x69, 0x74, 0xff, 0xfb, 0x19, 0xac, 0x2f, 0x17, 0xff, 0x24,
+  0x20, 0xae, 0xdc, 0xc1, 0xf2, 0x43, 0x2e, 0x8a, 0xf4, 0xdb, 0xc3, 0xcc, 0xa1, 0x8a, 0x13, 0x7d,
+  0xc7, 0x57, 0x41, 0x31, 0xaf, 0x98, 0x9d, 0x25, 0xec, 0x83, 0x80, 0xfb, 0xd7, 0x31, 0x06, 0x84,
+  0x2f, 0x65, 0x20, 0xf9, 0x7a, 0x66, 0xb9, 0x86, 0x6a, 0x95, 0x30, 0xa6, 0x46, 0xef, 0x62, 0x05,
+  0x89, 0xf8, 0x98, 0x16, 0x85, 0xc3, 0x68, 0x9c, 0xc8, 0x61, 0x34, 0x21, 0xe4, 0x94, 0x65, 0xff,
+  0x98, 0xc1, 0xae, 0x55, 0x8e, 0x92, 0x99, 0xb3, 0x54, 0x71, 0x99, 0xde, 0x81, 0xd4, 0xbf, 0x8d,
+  0x30, 0xc8, 0xaa, 0x70, 0x70, 0x87, 0x47, 0xaf, 0x3f, 0x82, 0x68, 0x17, 0x1e, 0x0c, 0xa9, 0x78,
+  0x65, 0x36, 0x95, 0x7d, 0x8d, 0xd4, 0x93, 0x2c, 0xd7, 0xb2, 0x39, 0x25, 0x55, 0x15, 0xb9, 0x5a,
+  0xf5, 0x72, 0x4a, 0xcd, 0xc6, 0x47, 0xfe, 0x8e, 0xc9, 0x80, 0x6d, 0x43, 0x57, 0x3e, 0x86, 0x11,
+  0x9e, 0xe7, 0x33, 0x43, 0xd3, 0xcc, 0x0c, 0x8e, 0x93, 0x8d, 0xac, 0x3c, 0x8d, 0x10, 0x9c, 0x51,
+  0x9e, 0x7e, 0x58, 0xda, 0xfa, 0x33, 0xba, 0x51, 0xf1, 0x65, 0xe5, 0x39, 0xf6, 0xff, 0x21, 0xdf,
+  0x66, 0x2e, 0xf9, 0xaa, 0x7c, 0xc6, 0x37, 0xa0, 0x22, 0x2d, 0x67, 0xf9, 0xc5, 0x6c, 0xf9, 0xa6,
+  0x64, 0xae, 0x40, 0x82, 0x2f, 0xfc, 0x8f, 0x8a, 0xbb, 0x1a, 0x61, 0xd9, 0x05, 0x5d, 0xcb, 0x2e,
+  0xf8, 0xc6, 0x4d, 0x4b, 0xc5, 0x5d, 0x88, 0xde, 0xd6, 0x0c, 0xe4, 0x96, 0x10, 0x7c, 0x84, 0xef,
+  0xf6, 0x36, 0x1e, 0x0c, 0xc1, 0x47, 0xe6, 0xf0, 0x25, 0xd7, 0x39, 0x5a, 0xef, 0x20, 0x61, 0x4c,
+  0x42, 0x74, 0x43, 0x4c, 0xd4, 0x3b, 0xa2, 0xb2, 0xaa, 0xb2, 0x55, 0x87, 0x37, 0xee, 0x88, 0xb0,
+  0x15, 0xc7, 0x00, 0x67, 0x1d, 0xf8, 0xa9, 0x3f, 0xd1, 0x3a, 0x56, 0x07, 0x63, 0x0c, 0xd4, 0xd6,
+  0xac, 0x8d, 0xc3, 0x94, 0x04, 0x28, 0x15, 0x2b, 0x19, 0x3a, 0xef, 0x61, 0x28, 0xbb, 0x86, 0x8e,
+  0x65, 0xfe, 0x0a, 0x24, 0xd5, 0x0c, 0x4a, 0xc7, 0xa5, 0xe6, 0xb9, 0x83, 0x3a, 0x45, 0x56, 0x97,
+  0x27, 0x68, 0x1a, 0xfc, 0x80, 0xa0, 0x38, 0xbe, 0xf0, 0xa8, 0xe2, 0x3a, 0xdf, 0xc3, 0x01, 0xa6,
+  0xf7, 0xcb, 0x5b, 0x32, 0xc3, 0xf7, 0xfd, 0xfd, 0x4c, 0x84, 0x25, 0x70, 0xa7, 0xc3, 0x6d, 0xc3,
+  0xc9, 0xb0, 0x13, 0x76, 0x33, 0x7b, 0x57, 0x7c, 0xb7, 0x2a, 0x95, 0xc2, 0xbb, 0x82, 0x03, 0xb8,
+  0xbe, 0x74, 0x22, 0xa3, 0x34, 0x36, 0x5b, 0xce, 0x4a, 0xe9, 0x77, 0x06, 0x76, 0xba, 0xdc, 0x0f,
+  0x81, 0xf4, 0xb8, 0x21, 0xec, 0xfc, 0x14, 0x7a, 0xff, 0x2e, 0x19, 0x74, 0xb1, 0x7e, 0x85, 0xd9,
+  0x92, 0xf3, 0x94, 0xb3, 0xf8, 0x7f, 0xc4, 0x77, 0x8c, 0xc8, 0x65, 0x12, 0x00, 0x00
+};
+
+// index.html: 12328 байт, gzip 4110 байт
+const uint8_t INDEX_HTML_GZ[] PROGMEM = {
+  0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xdd, 0x5b, 0xfd, 0x72, 0x13, 0xd7,
+  0x15, 0xff, 0x5f, 0x4f, 0x71, 0xa3, 0x86, 0xec, 0xaa, 0x58, 0x2b, 0x19, 0x13, 0x48, 0xb0, 0x64,
+  0x86, 0x18, 0xa7, 0xa1, 0xc3, 0x47, 0x06, 0x43, 0x93, 0x0c, 0x43, 0xc8, 0x4a, 0x7b, 0x2d, 0x6d,
+  0x58, 0xed, 0x2a, 0xbb, 0x2b, 0x1b, 0x63, 0x3c, 0x83, 0x71, 0x08, 0xc9, 0x40, 0xe3, 0x84, 0xd0,
+  0x36, 0xa5, 0x4d, 0x08, 0x49, 0x3b, 0x4c, 0x67, 0xda, 0x19, 0xc5, 0x60, 0x30, 0xc6, 0x36, 0x33,
+  0x79, 0x82, 0xd5, 0x2b, 0xf0, 0x02, 0xcd, 0x23, 0xf4, 0x9c, 0x73, 0xf7, 0x4b, 0xab, 0x95, 0x6c,
+  0x07, 0xda, 0x3f, 0xfa, 0x07, 0xd6, 0xee, 0xfd, 0x38, 0xf7, 0xdc, 0x73, 0xcf, 0xf9, 0x9d, 0x8f,
+  0xbb, 0x94, 0x5e, 0x3a, 0x7c, 0x62, 0xfc, 0xd4, 0x7b, 0x6f, 0x4f, 0xb0, 0xba, 0xdb, 0x30, 0xc6,
+  0x32, 0x25, 0xfc, 0x61, 0x86, 0x6a, 0xd6, 0xca, 0x59, 0xbb, 0x95, 0xc5, 0x06, 0xae, 0x6a, 0xf0,
+  0xd3, 0xe0, 0xae, 0xca, 0xaa, 0x75, 0xd5, 0x76, 0xb8, 0x5b, 0xce, 0x9e, 0x3e, 0xf5, 0x66, 0xfe,
+  0xb5, 0x6c, 0xd0, 0x6c, 0xaa, 0x0d, 0x5e, 0xce, 0x4e, 0xeb, 0x7c, 0xa6, 0x69, 0xd9, 0x6e, 0x96,
+  0x55, 0x2d, 0xd3, 0xe5, 0x26, 0x0c, 0x9b, 0xd1, 0x35, 0xb7, 0x5e, 0xd6, 0xf8, 0xb4, 0x5e, 0xe5,
+  0x79, 0x7a, 0x19, 0x62, 0xba, 0xa9, 0xbb, 0xba, 0x6a, 0xe4, 0x9d, 0xaa, 0x6a, 0xf0, 0xf2, 0xb0,
+  0x52, 0x44, 0x32, 0xae, 0xee, 0x1a, 0x7c, 0xcc, 0xfb, 0xab, 0xb7, 0xd2, 0xb9, 0xe2, 0xad, 0x78,
+  0x9b, 0x9d, 0x05, 0xf8, 0x6d, 0x7b, 0x1b, 0x9d, 0x4f, 0xbc, 0xd5, 0xce, 0x52, 0xa9, 0x20, 0xfa,
+  0x33, 0x25, 0xa7, 0x6a, 0xeb, 0x4d, 0x97, 0x39, 0x76, 0xb5, 0x9c, 0x2d, 0x20, 0x37, 0xae, 0xf2,
+  0xa1, 0x73, 0x70, 0xba, 0xac, 0xed, 0xdf, 0xfb, 0x1a, 0x2f, 0x56, 0xf6, 0x17, 0xf7, 0x8e, 0xec,
+  0x1f, 0x7e, 0x75, 0xf8, 0xf5, 0xec, 0x58, 0xa9, 0x20, 0xc6, 0xc2, 0x24, 0x43, 0x37, 0xcf, 0x33,
+  0x9b, 0x1b, 0xe5, 0xac, 0xe3, 0xce, 0x1a, 0xdc, 0xa9, 0x73, 0x0e, 0x4c, 0xd6, 0x6d, 0x3e, 0x05,
+  0x44, 0xa8, 0x49, 0xa9, 0x3a, 0x48, 0xa5, 0xb2, 0xff, 0xb5, 0xca, 0xf0, 0xde, 0x7d, 0x95, 0xfd,
+  0x55, 0xed, 0xd5, 0xe1, 0x29, 0xbe, 0x17, 0x39, 0x2b, 0xf8, 0xfb, 0xaf, 0x58, 0xda, 0x2c, 0xfc,
+  0x68, 0xfa, 0x34, 0xab, 0x1a, 0xaa, 0xe3, 0x94, 0xb3, 0xb8, 0x4b, 0x55, 0x37, 0xb9, 0x1d, 0x48,
+  0x89, 0xdb, 0xf8, 0x30, 0x3c, 0x56, 0x72, 0x9a, 0xaa, 0x19, 0x8c, 0xd2, 0x61, 0x58, 0x76, 0xec,
+  0xe7, 0x3b, 0x37, 0xfe, 0xf6, 0xef, 0x55, 0xd8, 0x08, 0x76, 0x8d, 0x31, 0xef, 0x07, 0x6f, 0xdd,
+  0xdb, 0xf0, 0xda, 0x9d, 0x25, 0x06, 0x0f, 0x7d, 0xf6, 0x0c, 0x94, 0x32, 0xa5, 0x26, 0x0a, 0x65,
+  0x13, 0xc6, 0xae, 0x42, 0xe7, 0x66, 0xe7, 0xb2, 0xb7, 0x0a, 0xcf, 0xf7, 0x99, 0xf7, 0x14, 0x1a,
+  0xef, 0xc3, 0xbf, 0x07, 0x30, 0xfe, 0x7a, 0xe7, 0x2a, 0xeb, 0x2c, 0x76, 0x16, 0xbc, 0x27, 0xd0,
+  0xb0, 0x0c, 0x23, 0x1e, 0x33, 0x6f, 0x99, 0xc1, 0xd8, 0x15, 0x20, 0xf7, 0xa4, 0x73, 0x03, 0x66,
+  0x6c, 0x7a, 0xeb, 0xd0, 0x46, 0x4d, 0xb0, 0x1e, 0x92, 0x2b, 0x15, 0x9a, 0xc1, 0xee, 0x88, 0xef,
+  0xd8, 0xc6, 0xe0, 0x5c, 0x6c, 0x97, 0xd1, 0xdf, 0xfc, 0x8c, 0x6a, 0x9b, 0xba, 0x59, 0x63, 0x75,
+  0x5d, 0xd3, 0xb8, 0x99, 0x65, 0xba, 0x06, 0xfd, 0xcd, 0x3c, 0x75, 0xd2, 0xbe, 0x47, 0xd2, 0xb6,
+  0xfb, 0xec, 0xf6, 0x77, 0xf1, 0xdd, 0x7e, 0x07, 0x4b, 0x3e, 0x04, 0xbe, 0x80, 0x07, 0xdc, 0x34,
+  0xec, 0x13, 0x38, 0xd9, 0xf4, 0x1e, 0x7b, 0x6b, 0xde, 0x2a, 0x7b, 0x47, 0x7f, 0x53, 0x07, 0x3e,
+  0x46, 0xc4, 0x66, 0x7f, 0x88, 0x7a, 0x49, 0x1e, 0xcb, 0xde, 0x26, 0x4e, 0x5a, 0x11, 0x3b, 0x7e,
+  0x00, 0x33, 0x9e, 0x74, 0x3e, 0xef, 0x5c, 0xa3, 0x3d, 0x40, 0xcf, 0x1a, 0x4d, 0x57, 0x98, 0x77,
+  0x07, 0x7a, 0x1f, 0xd2, 0x76, 0x17, 0xfd, 0x99, 0xed, 0xa1, 0xc4, 0x6a, 0x28, 0xe5, 0x34, 0x32,
+  0xab, 0xde, 0x8a, 0xe2, 0x4b, 0x03, 0x84, 0xd0, 0x2d, 0x0a, 0xdd, 0x9c, 0xb2, 0xf2, 0x15, 0x95,
+  0x8e, 0x38, 0xd9, 0xac, 0xbb, 0xbc, 0x91, 0xed, 0x73, 0xd8, 0x5f, 0x04, 0x7b, 0x17, 0xdd, 0x28,
+  0x35, 0xbd, 0x99, 0x1d, 0xcb, 0xe7, 0xfd, 0xf6, 0x7e, 0x4b, 0x0d, 0xa0, 0xf9, 0x87, 0x9b, 0xa1,
+  0x3c, 0xef, 0xa0, 0xb2, 0xc0, 0x69, 0xaf, 0xe0, 0xf1, 0xc3, 0x5f, 0xd8, 0xd6, 0xa6, 0xf7, 0x23,
+  0x1d, 0xf3, 0x32, 0x35, 0xd3, 0xa6, 0x0e, 0xc4, 0x16, 0x77, 0xf5, 0x06, 0xc7, 0xe5, 0x0f, 0xe4,
+  0xf3, 0x2c, 0x9f, 0x57, 0x9e, 0x87, 0x8f, 0xaf, 0x1e, 0xf6, 0xee, 0xcd, 0x76, 0x1c, 0x3d, 0x65,
+  0x77, 0xbd, 0xc4, 0x35, 0xd5, 0xa9, 0x57, 0x2c, 0xd5, 0xd6, 0x12, 0x02, 0xad, 0x42, 0x13, 0x83,
+  0x35, 0x9b, 0xdc, 0x56, 0xdd, 0x96, 0xcd, 0x53, 0xba, 0xf3, 0x42, 0x55, 0xfb, 0x49, 0xfc, 0x6e,
+  0xa4, 0x70, 0xa5, 0xfa, 0x9e, 0x31, 0xef, 0x7b, 0x52, 0xf5, 0xa7, 0x60, 0x5c, 0x97, 0x41, 0x09,
+  0xae, 0x80, 0x7d, 0xc0, 0x2f, 0xe8, 0xd9, 0x9e, 0xb4, 0x3d, 0x13, 0x7d, 0xb4, 0x70, 0xa0, 0x9e,
+  0x6c, 0x9e, 0x56, 0x8d, 0x16, 0xc9, 0x8e, 0xfd, 0xd4, 0x1e, 0x17, 0x73, 0x4b, 0xcd, 0xae, 0x11,
+  0x1a, 0x17, 0x50, 0xa3, 0x23, 0x2b, 0xb4, 0xf0, 0x1a, 0x2c, 0xf7, 0x19, 0x99, 0x37, 0x99, 0x76,
+  0x0f, 0x1f, 0x78, 0x5e, 0x6b, 0x9d, 0xcb, 0xa0, 0xab, 0xa0, 0xb3, 0xa0, 0x88, 0x9f, 0xc1, 0xa0,
+  0xc7, 0x0c, 0x54, 0x15, 0x0d, 0xf4, 0x41, 0xe7, 0x3a, 0xaa, 0x63, 0x7f, 0x21, 0x92, 0xb0, 0xea,
+  0xad, 0x86, 0xae, 0xe9, 0xee, 0xec, 0x8e, 0x25, 0x75, 0xf3, 0x5e, 0x5c, 0x4c, 0x37, 0x41, 0x5f,
+  0xda, 0xc0, 0xc5, 0x86, 0xc0, 0x9f, 0xce, 0x8d, 0xe7, 0x13, 0xd1, 0xae, 0x6d, 0x08, 0xe8, 0x5b,
+  0x90, 0x09, 0x2d, 0x47, 0x98, 0xb6, 0xe2, 0x23, 0x14, 0x61, 0xe1, 0x72, 0x92, 0x1b, 0x6c, 0xda,
+  0xf4, 0x1e, 0x81, 0x4c, 0x16, 0x3b, 0x57, 0xf1, 0xfc, 0xb6, 0x94, 0x4b, 0xd3, 0xe6, 0x8e, 0x03,
+  0x1a, 0x14, 0x20, 0xd6, 0x4e, 0xc5, 0x73, 0xef, 0x5f, 0x71, 0xf1, 0xdc, 0x02, 0x76, 0x62, 0x26,
+  0xf5, 0x7c, 0xc2, 0x01, 0xc0, 0xbe, 0x83, 0x7b, 0xd8, 0x52, 0x42, 0x5f, 0x80, 0x5c, 0xd6, 0x49,
+  0x04, 0x1f, 0x93, 0xde, 0xa0, 0x61, 0x83, 0x8d, 0x3f, 0x48, 0x32, 0xb3, 0xa5, 0x30, 0x6c, 0xf0,
+  0x4f, 0x3b, 0x37, 0xa5, 0x7b, 0x09, 0x53, 0xba, 0x45, 0xd8, 0xfa, 0xe0, 0x39, 0x75, 0xc3, 0xdf,
+  0x77, 0xb2, 0xdf, 0x71, 0xc1, 0xe0, 0x1d, 0x26, 0x7e, 0xf2, 0x9a, 0x3d, 0x9b, 0xca, 0xd5, 0xb3,
+  0xaf, 0x2f, 0xc7, 0x1d, 0xca, 0x97, 0x20, 0x83, 0x47, 0x8c, 0x74, 0xa8, 0x4d, 0x68, 0x0e, 0xc0,
+  0xb7, 0x0d, 0xb9, 0xde, 0x21, 0x0f, 0x0a, 0x8e, 0xf3, 0x00, 0x43, 0x7e, 0x7a, 0xc4, 0x37, 0x00,
+  0xaf, 0xba, 0x1c, 0x20, 0x04, 0x1e, 0xa6, 0xc9, 0x0d, 0x27, 0x9b, 0x2a, 0x0c, 0x08, 0x0b, 0x6c,
+  0x0b, 0x3b, 0xd3, 0x9a, 0xf3, 0xb0, 0x01, 0x6e, 0xc0, 0xc4, 0x74, 0xc7, 0x19, 0x77, 0x1d, 0xde,
+  0x37, 0x83, 0x7c, 0xe5, 0x94, 0x65, 0x37, 0x98, 0x5a, 0xc5, 0x9d, 0x61, 0x14, 0xa3, 0x4e, 0xf3,
+  0x19, 0x7d, 0x4a, 0xcf, 0x32, 0x08, 0xc8, 0xea, 0x16, 0xf0, 0xd8, 0xb4, 0x1c, 0x72, 0xd0, 0xba,
+  0xd9, 0x6c, 0xb9, 0xcc, 0x9d, 0x6d, 0x42, 0x84, 0x16, 0xec, 0x41, 0xc4, 0x6b, 0x55, 0xc7, 0x9e,
+  0x4a, 0x30, 0x89, 0x44, 0xf3, 0x35, 0xdb, 0x6a, 0x81, 0xaf, 0x2a, 0x19, 0x6a, 0x85, 0x1b, 0x0c,
+  0x9a, 0x20, 0x6e, 0x72, 0x74, 0x40, 0x6c, 0xef, 0x6b, 0x6f, 0x1d, 0x21, 0x6d, 0x81, 0x22, 0x96,
+  0x55, 0x26, 0x4f, 0x4e, 0x1e, 0x39, 0x9c, 0x2b, 0x15, 0x68, 0x60, 0x62, 0x29, 0x97, 0x5f, 0xc0,
+  0x40, 0x30, 0x46, 0xd6, 0x17, 0x80, 0x90, 0x20, 0x11, 0xf4, 0xf9, 0x10, 0xcf, 0x0d, 0xf5, 0x82,
+  0xc1, 0xcd, 0x1a, 0x84, 0x8b, 0xd9, 0x91, 0xe1, 0x2c, 0x84, 0x6b, 0x1f, 0xb5, 0x74, 0x9b, 0x6b,
+  0x69, 0x12, 0xee, 0xc7, 0x65, 0x13, 0x7a, 0x67, 0x2c, 0xf4, 0x2d, 0x68, 0x67, 0x24, 0xb6, 0x27,
+  0xa8, 0xb4, 0x69, 0xfc, 0x85, 0x63, 0xfb, 0xf3, 0x18, 0x0d, 0x11, 0x7c, 0x46, 0xef, 0x31, 0x5e,
+  0xf7, 0x8d, 0x64, 0x59, 0xd3, 0x50, 0xab, 0xbc, 0x6e, 0x19, 0x60, 0x52, 0xe5, 0x2c, 0xc0, 0x9b,
+  0x88, 0xe3, 0x96, 0x3b, 0x37, 0xfc, 0x88, 0x03, 0x63, 0x33, 0x38, 0xc6, 0xeb, 0xde, 0xfa, 0x10,
+  0xeb, 0x5c, 0xc3, 0x38, 0xce, 0xfb, 0xb1, 0x73, 0xdd, 0x0f, 0x6b, 0x28, 0x1c, 0xeb, 0x2c, 0x21,
+  0xd8, 0x45, 0xea, 0x54, 0x69, 0xb9, 0xae, 0x65, 0xfa, 0xac, 0x3a, 0xad, 0x4a, 0x43, 0x8f, 0x84,
+  0x59, 0x71, 0x4d, 0x06, 0xff, 0xf2, 0x15, 0xc3, 0xaa, 0x9e, 0xef, 0x87, 0xf1, 0x9b, 0xa1, 0x12,
+  0xdd, 0x05, 0x9d, 0xbf, 0x8a, 0x3e, 0x47, 0xc4, 0x90, 0x28, 0x0f, 0x41, 0x1d, 0xf5, 0x1d, 0x37,
+  0x9d, 0x8e, 0x1e, 0xdb, 0xd2, 0xd6, 0x67, 0xb7, 0xff, 0x1c, 0xb7, 0xca, 0xbb, 0xb0, 0xc0, 0x82,
+  0xef, 0xf0, 0x20, 0x2a, 0xc5, 0xdd, 0xf5, 0x84, 0x7b, 0xe9, 0xda, 0xcb, 0x5d, 0xf7, 0x62, 0xa4,
+  0xba, 0x35, 0xee, 0x6e, 0x53, 0x2f, 0x61, 0xd6, 0x98, 0x77, 0x0f, 0xd7, 0xa0, 0xd0, 0x67, 0x13,
+  0x23, 0x5f, 0x08, 0xf0, 0x40, 0x9c, 0x0b, 0xd1, 0xb1, 0x3b, 0xdc, 0xe0, 0x55, 0x37, 0xfd, 0x9c,
+  0xc5, 0xc9, 0xe2, 0xe2, 0x14, 0x25, 0x5d, 0xa4, 0xbc, 0x81, 0xc6, 0xef, 0x44, 0xf1, 0x10, 0x66,
+  0xcf, 0xb9, 0x90, 0x50, 0x38, 0xa8, 0x05, 0x71, 0xa0, 0x41, 0xd0, 0x16, 0xe0, 0xb9, 0x94, 0xae,
+  0x87, 0x66, 0xab, 0x51, 0x01, 0x24, 0xee, 0xaf, 0x85, 0x09, 0xda, 0x3e, 0xc7, 0xc9, 0x15, 0x5f,
+  0x94, 0xe2, 0xc4, 0x82, 0xcc, 0x6f, 0xc3, 0x88, 0xb2, 0x9f, 0xda, 0x74, 0x1f, 0x22, 0xa4, 0x73,
+  0x7a, 0x05, 0xa2, 0x37, 0xde, 0x7d, 0x90, 0x8c, 0x12, 0xac, 0x72, 0xb6, 0xa1, 0xda, 0x35, 0xdd,
+  0xcc, 0xbb, 0x56, 0xf3, 0x00, 0x1b, 0x2e, 0x36, 0x2f, 0x8c, 0x66, 0x9f, 0x9b, 0xdd, 0x67, 0xb7,
+  0xef, 0x86, 0xdc, 0xde, 0xc6, 0xd8, 0x1f, 0xbc, 0xe2, 0x8f, 0x24, 0xf7, 0x65, 0x0a, 0xb5, 0x6e,
+  0x90, 0xcb, 0x84, 0x87, 0x6b, 0xd0, 0xb1, 0xf6, 0x02, 0xf5, 0xfe, 0xe7, 0x3b, 0x7f, 0xfc, 0x7b,
+  0x3f, 0xc5, 0x6f, 0xf7, 0xc5, 0x67, 0xcb, 0x55, 0xff, 0x4b, 0xf0, 0x0c, 0x94, 0xcf, 0xb5, 0x1c,
+  0x74, 0xe8, 0x27, 0x4e, 0x1d, 0x62, 0xde, 0x5f, 0x28, 0x37, 0x84, 0x44, 0xf1, 0x17, 0x41, 0x73,
+  0x48, 0xcc, 0xe7, 0x23, 0x7a, 0x7f, 0x01, 0x10, 0x8d, 0xc4, 0x10, 0x47, 0x7d, 0x4e, 0x5f, 0x04,
+  0x4c, 0x87, 0x24, 0x63, 0xfc, 0x8a, 0xf7, 0xff, 0x37, 0x98, 0xee, 0x56, 0xa9, 0x56, 0x53, 0xfb,
+  0x9f, 0x1a, 0xdb, 0x3f, 0x3f, 0x89, 0xa9, 0x3c, 0x9d, 0xde, 0xb7, 0xbd, 0x39, 0xe7, 0x96, 0x5c,
+  0x03, 0x62, 0x21, 0x9f, 0x2f, 0x9e, 0x69, 0x7a, 0xd2, 0x54, 0xb3, 0xd6, 0x37, 0xae, 0xbd, 0xf5,
+  0x71, 0x2c, 0x81, 0x5e, 0xa1, 0x54, 0xeb, 0x11, 0xc8, 0xfb, 0x3e, 0xe5, 0x61, 0x8f, 0xb6, 0x72,
+  0x8e, 0x5b, 0x61, 0x45, 0xb0, 0x8b, 0x9a, 0xad, 0x6b, 0xa0, 0xa0, 0x46, 0xab, 0x61, 0xc2, 0x36,
+  0x58, 0x81, 0xe5, 0x87, 0x47, 0xfb, 0x3b, 0xd0, 0xa5, 0xfb, 0x21, 0x4f, 0x5f, 0x93, 0x42, 0x52,
+  0x89, 0x07, 0x53, 0xa1, 0x55, 0x60, 0x69, 0xdd, 0x67, 0x13, 0x45, 0xfb, 0xd8, 0xc7, 0x95, 0x38,
+  0x03, 0x58, 0xff, 0xca, 0x47, 0x65, 0x28, 0x32, 0x87, 0xba, 0xee, 0xb8, 0x96, 0x3d, 0x3b, 0x8e,
+  0x7d, 0xa9, 0xf1, 0xa9, 0x3f, 0x20, 0xdf, 0x55, 0xbe, 0x72, 0xd5, 0x8a, 0xc1, 0xc7, 0x4a, 0x2e,
+  0x15, 0xbb, 0x4a, 0xae, 0x8d, 0x8f, 0x90, 0x1c, 0x8a, 0x82, 0x11, 0x15, 0xe0, 0xea, 0xa2, 0xc9,
+  0x4f, 0xab, 0x95, 0xa8, 0x25, 0xcc, 0x20, 0x63, 0x6d, 0xb1, 0x8c, 0x01, 0x9b, 0x0a, 0x48, 0xb0,
+  0x10, 0x10, 0xa7, 0x4a, 0x1a, 0xbc, 0x06, 0xbf, 0xb4, 0x74, 0x26, 0x61, 0x53, 0x96, 0x59, 0x35,
+  0xf4, 0xea, 0xf9, 0x72, 0x56, 0xa8, 0xf9, 0x5b, 0x82, 0x69, 0x39, 0xb7, 0x23, 0xfb, 0x8a, 0x9d,
+  0xf8, 0x00, 0x6f, 0x26, 0xd6, 0x9d, 0xb2, 0x2c, 0x97, 0x03, 0x9b, 0xcd, 0x3e, 0xa6, 0xfa, 0x64,
+  0x07, 0xb5, 0x3b, 0xf6, 0xd3, 0x3f, 0xd8, 0x9e, 0xe2, 0x9e, 0x11, 0x76, 0x89, 0x81, 0x78, 0xe0,
+  0x0c, 0x29, 0xd7, 0x5d, 0x62, 0x7b, 0x94, 0xd7, 0x45, 0xd6, 0xe1, 0x2f, 0x16, 0x2e, 0x1e, 0x94,
+  0x2a, 0x61, 0x31, 0xc7, 0x65, 0xf1, 0x23, 0x64, 0x65, 0x66, 0xf2, 0x19, 0x76, 0x14, 0x0e, 0x8a,
+  0xde, 0x65, 0xcd, 0xaa, 0xb6, 0x1a, 0xdc, 0x74, 0x15, 0x30, 0x9d, 0x09, 0x83, 0xe3, 0xe3, 0x1b,
+  0xb3, 0x47, 0x34, 0x59, 0x8a, 0xcf, 0x92, 0x72, 0x43, 0xec, 0x4c, 0x66, 0x8e, 0x11, 0xa4, 0x1e,
+  0x60, 0x52, 0x7a, 0x35, 0x84, 0xc9, 0x3f, 0xb5, 0xc7, 0x73, 0xd2, 0x10, 0x6b, 0x99, 0xba, 0x0b,
+  0xa3, 0xe0, 0x0d, 0x5e, 0x40, 0x77, 0x2d, 0x1b, 0xde, 0x7e, 0xb5, 0x77, 0x64, 0xdf, 0x30, 0xe7,
+  0xd0, 0xa2, 0x5e, 0xd0, 0x1d, 0x68, 0x30, 0xf8, 0x94, 0x2b, 0xb1, 0xf9, 0xa1, 0x38, 0xdd, 0x9e,
+  0xf2, 0x01, 0x93, 0x77, 0xc5, 0x28, 0xee, 0xea, 0xa2, 0x57, 0xad, 0xbe, 0x3e, 0x55, 0x8c, 0xe8,
+  0xd9, 0x7a, 0xad, 0xee, 0xc2, 0x6b, 0x43, 0x07, 0x4b, 0x29, 0x0e, 0x21, 0x5c, 0xa3, 0xe1, 0x17,
+  0xd9, 0x7c, 0xe6, 0x6c, 0x6e, 0x34, 0x63, 0x70, 0x97, 0x61, 0x60, 0xa8, 0x9b, 0x35, 0xe7, 0xa8,
+  0x05, 0xf9, 0xaa, 0x06, 0xb2, 0x98, 0x52, 0x0d, 0x87, 0x8f, 0x66, 0x0a, 0x05, 0x36, 0x3e, 0x79,
+  0xf2, 0xcd, 0x3c, 0x81, 0xf4, 0x1a, 0x5a, 0x08, 0xe2, 0x37, 0x5a, 0xce, 0x55, 0x2a, 0xef, 0xc1,
+  0x19, 0x63, 0x09, 0xb4, 0x6a, 0x59, 0xe7, 0x75, 0x8e, 0x35, 0x04, 0x3c, 0x28, 0xf2, 0xd0, 0x98,
+  0xbd, 0x6c, 0x32, 0x3f, 0x26, 0x15, 0x60, 0xfb, 0x09, 0x16, 0x5f, 0x32, 0x53, 0x2d, 0x93, 0x30,
+  0x8a, 0x81, 0x5c, 0xc7, 0x69, 0x9e, 0x8c, 0xfe, 0x24, 0xc7, 0xe6, 0xfc, 0x53, 0x69, 0xa8, 0x6e,
+  0xb5, 0x0e, 0x2c, 0x84, 0x07, 0x20, 0xa8, 0x2b, 0xd4, 0x2e, 0xe3, 0x21, 0x9d, 0xe4, 0xb5, 0x89,
+  0x0b, 0x4d, 0x59, 0x92, 0x0f, 0x1e, 0x78, 0xff, 0xd2, 0x28, 0xcb, 0x49, 0x6c, 0x37, 0xf9, 0x24,
+  0xf8, 0x91, 0xca, 0xf2, 0x99, 0xf7, 0x47, 0xcf, 0xfe, 0x3a, 0x27, 0xe5, 0x60, 0x6b, 0x36, 0x77,
+  0x5b, 0xb6, 0xe9, 0x53, 0x3c, 0xc8, 0x34, 0x5e, 0xb5, 0x34, 0x7e, 0xfa, 0xe4, 0x91, 0x71, 0xab,
+  0xd1, 0xb4, 0x4c, 0xa0, 0x2d, 0x53, 0xd7, 0x99, 0xe1, 0xb3, 0x39, 0x06, 0x82, 0x92, 0x46, 0x33,
+  0xf3, 0x11, 0x7f, 0x53, 0xba, 0x61, 0x4c, 0xfa, 0x72, 0x91, 0xc1, 0x36, 0xd4, 0x88, 0x45, 0xf7,
+  0x62, 0x9c, 0xbf, 0xa4, 0x82, 0xb8, 0x17, 0x25, 0x58, 0x1b, 0x50, 0x8d, 0xc9, 0x28, 0x5b, 0x1d,
+  0xc6, 0xe6, 0x87, 0xf7, 0x8c, 0xc2, 0x43, 0xa9, 0xcc, 0x86, 0xf7, 0xc2, 0xc3, 0xee, 0xdd, 0x11,
+  0x2d, 0x8b, 0x92, 0xe6, 0xae, 0xfd, 0xda, 0x1c, 0x2c, 0xd1, 0x27, 0x29, 0x4b, 0x62, 0x00, 0x92,
+  0x14, 0x4f, 0x0a, 0x65, 0xfa, 0x30, 0x41, 0x0f, 0x5b, 0x30, 0xd2, 0x18, 0x17, 0x77, 0x01, 0xd0,
+  0x2e, 0x9d, 0x3e, 0x35, 0x8e, 0x22, 0x91, 0x75, 0x36, 0x56, 0x66, 0x45, 0xd8, 0xb8, 0xb4, 0x5b,
+  0xa2, 0xfd, 0xe5, 0xa0, 0x35, 0x9a, 0x25, 0xe2, 0x6f, 0x3a, 0x6e, 0x18, 0x5a, 0x2e, 0x03, 0x0b,
+  0xb0, 0x4b, 0xc5, 0xbd, 0x08, 0x4b, 0xb9, 0x17, 0x15, 0xb5, 0xd9, 0xe4, 0xa6, 0x36, 0x5e, 0xd7,
+  0x0d, 0x4d, 0x16, 0x33, 0x72, 0x28, 0x9f, 0xbe, 0xdb, 0xee, 0x0e, 0x95, 0xa5, 0x5c, 0xc8, 0xa7,
+  0xa0, 0x1a, 0x74, 0x8c, 0xf6, 0xa7, 0x80, 0x09, 0x6a, 0x72, 0x1e, 0xb6, 0x0d, 0x98, 0x12, 0x04,
+  0x4d, 0xc9, 0x69, 0xd0, 0x7e, 0x1a, 0x9a, 0x63, 0x33, 0x3f, 0x6a, 0x71, 0x7b, 0x76, 0x92, 0xb6,
+  0x6c, 0xd9, 0x87, 0x0c, 0x43, 0x96, 0x28, 0xfe, 0x39, 0x13, 0x0b, 0x02, 0xcf, 0x02, 0x15, 0x38,
+  0xb6, 0x09, 0x15, 0xf4, 0x4c, 0x04, 0x47, 0xe5, 0x31, 0x46, 0x0f, 0x21, 0xf1, 0x48, 0x69, 0x25,
+  0x9c, 0x42, 0x5a, 0xd6, 0x63, 0x3c, 0xae, 0xdd, 0xe2, 0x28, 0x2a, 0xb0, 0x1e, 0x48, 0xe5, 0x37,
+  0x08, 0xb9, 0x36, 0x10, 0x9a, 0xc0, 0x40, 0x62, 0x15, 0xb7, 0x30, 0x63, 0x61, 0x79, 0x76, 0x12,
+  0x84, 0x77, 0x04, 0x0f, 0xd0, 0xd1, 0xdd, 0x59, 0x4a, 0xe7, 0x98, 0x1f, 0x26, 0xc5, 0x4b, 0xf4,
+  0x2b, 0xbe, 0xce, 0x9c, 0x3c, 0x74, 0xe4, 0xf8, 0xb9, 0x23, 0xc7, 0x4f, 0x4d, 0x1c, 0x9f, 0x3c,
+  0x72, 0xea, 0x3d, 0x58, 0xf1, 0x8c, 0x84, 0xd1, 0x53, 0xe7, 0x0a, 0x58, 0xb9, 0x44, 0x15, 0xeb,
+  0x36, 0x86, 0x54, 0xde, 0x63, 0x7a, 0x5f, 0x8c, 0xf9, 0xb7, 0x8d, 0xb0, 0x15, 0xd9, 0xa1, 0x8a,
+  0x20, 0xb5, 0x9c, 0x1d, 0x8d, 0x14, 0x1f, 0x0e, 0xde, 0x00, 0x49, 0x99, 0x8e, 0x65, 0x1f, 0x06,
+  0x59, 0x86, 0xba, 0x9f, 0x2e, 0x4a, 0x59, 0x52, 0x62, 0xf5, 0x64, 0xa6, 0x44, 0xc5, 0x28, 0x90,
+  0x66, 0xb7, 0x62, 0x0a, 0x45, 0x80, 0xc1, 0x68, 0xa8, 0x58, 0xe5, 0x95, 0x46, 0xfb, 0x13, 0x0d,
+  0xea, 0xae, 0x5b, 0x53, 0x84, 0x91, 0x44, 0x70, 0x97, 0x44, 0x80, 0x95, 0xac, 0x25, 0x32, 0x01,
+  0x49, 0x20, 0x71, 0x42, 0x31, 0xdc, 0xf3, 0x1a, 0x42, 0xd3, 0x62, 0x57, 0xd6, 0x82, 0x2e, 0x6b,
+  0x88, 0xe1, 0xaf, 0x08, 0x0e, 0x44, 0x5a, 0xbd, 0x82, 0x77, 0x3f, 0xb1, 0x18, 0x01, 0x02, 0xd3,
+  0xcf, 0x3b, 0x57, 0xfc, 0x53, 0x08, 0x2b, 0xa0, 0x31, 0xdb, 0x4d, 0xee, 0x22, 0x18, 0x83, 0xe6,
+  0x1b, 0x3c, 0x2b, 0xe4, 0xf2, 0x8e, 0x82, 0x1b, 0x51, 0x5c, 0xab, 0x56, 0x33, 0x38, 0xfa, 0x14,
+  0xcc, 0x48, 0xe0, 0x5c, 0x5e, 0x92, 0x25, 0x1c, 0x26, 0x81, 0xda, 0xd1, 0xe6, 0x50, 0xbf, 0xf4,
+  0x29, 0x96, 0x6c, 0x0d, 0xd7, 0xee, 0x59, 0x70, 0x2b, 0x61, 0xe1, 0x44, 0x92, 0x96, 0x28, 0x92,
+  0x82, 0xc8, 0xc4, 0x66, 0xd0, 0x7a, 0x7f, 0x17, 0x58, 0x50, 0xbf, 0xdd, 0xe0, 0xa0, 0xee, 0xf3,
+  0x88, 0x4f, 0x9f, 0x14, 0x15, 0xc6, 0xed, 0xcd, 0x17, 0x75, 0x48, 0x24, 0x10, 0xae, 0x9c, 0xc6,
+  0x6e, 0xd8, 0x29, 0xc6, 0x89, 0x25, 0x14, 0xdd, 0x84, 0x70, 0xea, 0xad, 0x53, 0xc7, 0x8e, 0xc6,
+  0x87, 0x21, 0xce, 0xa5, 0x56, 0x34, 0x6f, 0x45, 0xa1, 0x1f, 0x58, 0xdb, 0x97, 0xe8, 0xb2, 0x02,
+  0xd3, 0x03, 0x37, 0x8a, 0x48, 0xd9, 0x6d, 0x4f, 0x67, 0x88, 0xa4, 0x1e, 0x58, 0xe3, 0x59, 0x14,
+  0x57, 0x8e, 0x00, 0xf4, 0x97, 0x15, 0x4c, 0xa5, 0x2e, 0xde, 0x69, 0xf6, 0x71, 0xf4, 0x56, 0x09,
+  0xde, 0x53, 0xaa, 0xb4, 0xd8, 0x45, 0x0b, 0xa7, 0x57, 0x70, 0x07, 0x99, 0x4f, 0x4c, 0xd4, 0xb1,
+  0xda, 0x6c, 0x8f, 0x4e, 0x48, 0xf1, 0x5a, 0x2d, 0x8a, 0xa2, 0x1b, 0xac, 0x49, 0x53, 0x64, 0x30,
+  0x9f, 0x45, 0x72, 0xf8, 0x8f, 0xbb, 0x4c, 0x26, 0x36, 0xa1, 0xa2, 0x82, 0x33, 0x81, 0xd0, 0x49,
+  0x88, 0x6a, 0x00, 0x5e, 0xe3, 0xfd, 0x58, 0x1f, 0x5c, 0x80, 0x9e, 0xd1, 0x0c, 0x61, 0xcf, 0xb8,
+  0x5f, 0xf6, 0x25, 0xe4, 0x51, 0x82, 0x22, 0x70, 0x2e, 0x80, 0xd4, 0xdb, 0x98, 0xcc, 0x92, 0x95,
+  0x5e, 0xa3, 0x62, 0x2d, 0xfc, 0xc1, 0x00, 0xa3, 0x2d, 0xae, 0x65, 0x87, 0xc8, 0xde, 0xb1, 0x46,
+  0x81, 0x26, 0x1e, 0x8f, 0x17, 0x71, 0xe8, 0x06, 0x75, 0xae, 0xc5, 0x70, 0x20, 0x09, 0x02, 0x48,
+  0x0e, 0x0b, 0x1c, 0xeb, 0xd8, 0xec, 0xb5, 0x13, 0xb0, 0x18, 0xb2, 0x16, 0x72, 0x15, 0x3a, 0xf2,
+  0x30, 0xce, 0x1f, 0x14, 0x1b, 0x04, 0xd3, 0x7c, 0xcb, 0x11, 0x13, 0x06, 0x02, 0x42, 0x6c, 0xfb,
+  0x08, 0x04, 0xd1, 0x3b, 0x13, 0xd1, 0x4d, 0x9c, 0x4e, 0xdc, 0x2e, 0x82, 0x71, 0x10, 0x37, 0x35,
+  0xe5, 0x2a, 0x7a, 0xb2, 0x0f, 0x7a, 0xee, 0x12, 0x76, 0x7c, 0x65, 0xf1, 0xd5, 0xef, 0x63, 0xf7,
+  0x15, 0x2f, 0xcf, 0x55, 0x15, 0xf4, 0x9e, 0xf3, 0xcf, 0x71, 0x5d, 0x81, 0x34, 0xd0, 0x23, 0xcc,
+  0x47, 0x97, 0x7e, 0x99, 0x81, 0x57, 0x0b, 0xbd, 0x81, 0x30, 0x92, 0x00, 0x17, 0x30, 0xcf, 0x76,
+  0xbd, 0x3c, 0x17, 0xc1, 0x64, 0x15, 0x4d, 0x6a, 0xa8, 0xe7, 0x2e, 0x87, 0x54, 0xb6, 0xda, 0x83,
+  0x82, 0x14, 0x1d, 0xcd, 0xf7, 0xdc, 0x54, 0x7c, 0x90, 0x53, 0x3e, 0xb4, 0x74, 0x53, 0x96, 0xa4,
+  0x50, 0xf9, 0x6e, 0xe2, 0x35, 0x19, 0x05, 0xf7, 0x0b, 0x08, 0x24, 0x4f, 0x29, 0x2e, 0x6e, 0x53,
+  0x82, 0xbb, 0x21, 0xbe, 0x08, 0xe8, 0x89, 0x8f, 0x29, 0xf9, 0x45, 0x8d, 0xa3, 0xb4, 0x68, 0x8d,
+  0xbe, 0x11, 0x78, 0x37, 0x2f, 0x1c, 0x6c, 0xfe, 0x50, 0x8d, 0x33, 0x19, 0x52, 0xbf, 0x85, 0x9c,
+  0xaf, 0x46, 0x93, 0x00, 0x42, 0x27, 0x4e, 0x9e, 0x3b, 0x76, 0xe8, 0xdd, 0x73, 0x87, 0x7e, 0x33,
+  0x01, 0x07, 0xb9, 0xf7, 0xd5, 0x62, 0xb1, 0x18, 0x73, 0xcf, 0x22, 0x51, 0x8b, 0xf9, 0x67, 0x54,
+  0x41, 0x0c, 0x34, 0xd5, 0x1a, 0x62, 0x0a, 0x0e, 0xe5, 0x18, 0x29, 0x4b, 0x05, 0x47, 0x2c, 0x81,
+  0x56, 0x84, 0x36, 0x57, 0xe7, 0xa6, 0x6c, 0xa3, 0x22, 0xcc, 0x65, 0xc4, 0xd0, 0xe3, 0x54, 0x13,
+  0x95, 0x6d, 0x45, 0x9c, 0xb9, 0x83, 0xda, 0x2a, 0x4b, 0x71, 0xd6, 0x20, 0x62, 0xbc, 0x74, 0x89,
+  0x15, 0xa3, 0x50, 0xda, 0x56, 0x3e, 0x74, 0x2c, 0x53, 0x46, 0x71, 0xf8, 0x14, 0x91, 0xba, 0x4f,
+  0x34, 0x2d, 0x6e, 0x10, 0x5a, 0x8b, 0xeb, 0x8d, 0x25, 0xb6, 0xd6, 0x15, 0x52, 0xec, 0x0c, 0x27,
+  0x7c, 0x58, 0x5a, 0x14, 0xd6, 0x4d, 0xa1, 0xcd, 0x13, 0xf1, 0xfd, 0x42, 0x9b, 0x0e, 0xf8, 0x98,
+  0xea, 0xd6, 0x15, 0xdb, 0x6a, 0x99, 0x1a, 0xad, 0x5c, 0xc0, 0x6c, 0xa7, 0x98, 0xa3, 0x59, 0x20,
+  0x68, 0x69, 0x60, 0x18, 0xab, 0x37, 0xd3, 0xd7, 0xd5, 0x9b, 0x03, 0x60, 0x0d, 0xef, 0xe5, 0xd3,
+  0xa7, 0xa9, 0x4d, 0x54, 0x44, 0xc8, 0x0b, 0x05, 0x5a, 0xb5, 0xc9, 0xf7, 0x90, 0xe6, 0x2e, 0x82,
+  0xf2, 0x90, 0xe6, 0x09, 0x2f, 0x00, 0x14, 0x88, 0x41, 0xed, 0x8d, 0xc6, 0x20, 0x00, 0x0d, 0xbe,
+  0x09, 0x81, 0xd5, 0x06, 0xa1, 0x86, 0xbf, 0x76, 0x00, 0x1a, 0xdd, 0x21, 0x6a, 0x2e, 0x25, 0xb7,
+  0xa1, 0x03, 0xad, 0x52, 0x8a, 0xc5, 0xf1, 0x38, 0x51, 0x19, 0x2d, 0x83, 0x2b, 0xdc, 0xb6, 0xc1,
+  0x9f, 0xf0, 0x5c, 0x68, 0x00, 0xdf, 0x63, 0x6c, 0x89, 0x08, 0x09, 0x90, 0xda, 0x66, 0xb1, 0xca,
+  0x0e, 0x7e, 0x15, 0x02, 0x21, 0x28, 0xec, 0x6d, 0x89, 0x09, 0xe5, 0x87, 0x6c, 0x91, 0x92, 0xbf,
+  0x47, 0x8c, 0x72, 0xbf, 0x27, 0x3e, 0xc4, 0xae, 0xfb, 0x66, 0x09, 0x08, 0xdc, 0xf9, 0x14, 0xa3,
+  0x2c, 0xa4, 0xf1, 0x94, 0x6c, 0xea, 0x53, 0x8a, 0x91, 0xf1, 0xa6, 0x5e, 0xd0, 0xe9, 0x8a, 0xd8,
+  0x44, 0x5d, 0x41, 0x04, 0x66, 0x34, 0x05, 0xab, 0xc1, 0xde, 0xaa, 0x42, 0x6c, 0x7d, 0x45, 0xf3,
+  0x3f, 0xc6, 0x25, 0x58, 0x18, 0x37, 0xaf, 0x06, 0xec, 0x3c, 0xc5, 0xe9, 0xb8, 0xc4, 0x26, 0x29,
+  0xcb, 0xc3, 0x30, 0x16, 0x5e, 0xef, 0x1f, 0x6b, 0xb3, 0xd0, 0xc5, 0xb4, 0x61, 0x98, 0xf8, 0x08,
+  0x8a, 0x6c, 0x49, 0xe9, 0x2e, 0x1f, 0xa0, 0x5f, 0x47, 0x6b, 0x9a, 0x63, 0x68, 0x46, 0x90, 0x61,
+  0xb3, 0xf9, 0x98, 0xb5, 0x52, 0x1d, 0x2e, 0xac, 0xaa, 0x80, 0xca, 0xc7, 0x67, 0x91, 0xe1, 0x09,
+  0x9b, 0xed, 0xe7, 0xc8, 0xa9, 0x7a, 0x03, 0x87, 0x1d, 0x87, 0xf6, 0x44, 0xa2, 0x2a, 0x00, 0x41,
+  0x54, 0x2d, 0x22, 0x77, 0xd4, 0x04, 0xe0, 0x72, 0x31, 0x1a, 0x23, 0x63, 0x80, 0x9c, 0x5f, 0x1e,
+  0x86, 0xdc, 0x5f, 0xbc, 0x00, 0xa4, 0x01, 0xa8, 0xf8, 0x6f, 0x53, 0x86, 0x05, 0x0b, 0x6d, 0xb3,
+  0xdc, 0x01, 0x4a, 0xa7, 0x43, 0xd7, 0x3b, 0xf8, 0x89, 0x19, 0xd8, 0xd5, 0x48, 0x0e, 0x15, 0x23,
+  0xc0, 0x9b, 0x48, 0x44, 0x07, 0xc5, 0xea, 0x65, 0x34, 0x46, 0xf1, 0x18, 0xc7, 0x9f, 0x00, 0x44,
+  0x7a, 0x10, 0x24, 0xbe, 0x16, 0xa4, 0xa7, 0x6e, 0x08, 0x23, 0x8a, 0x20, 0x42, 0xbe, 0xac, 0x89,
+  0x63, 0x9b, 0x84, 0x03, 0x58, 0x7d, 0xe9, 0xd7, 0x0d, 0x4e, 0x05, 0xba, 0xfb, 0xf4, 0x82, 0xbf,
+  0xc8, 0x9d, 0xed, 0xdb, 0xeb, 0xe6, 0xb6, 0x67, 0x0e, 0xf1, 0xd0, 0x00, 0x52, 0xe5, 0xe0, 0x94,
+  0x13, 0xb5, 0x02, 0x3c, 0xc0, 0x01, 0x41, 0xb1, 0x7f, 0xc0, 0xa0, 0x01, 0x94, 0xcb, 0x08, 0x1a,
+  0x61, 0x1a, 0x6a, 0xf3, 0xaa, 0x65, 0x6b, 0x42, 0x3a, 0x68, 0xc9, 0xe2, 0x1d, 0x64, 0xf3, 0x11,
+  0x16, 0x13, 0x7a, 0x74, 0xa9, 0x2b, 0x28, 0xc0, 0xb0, 0xdc, 0x9a, 0x19, 0x50, 0x59, 0x70, 0x6d,
+  0x8a, 0xbf, 0xad, 0x99, 0x2e, 0xed, 0x82, 0x30, 0xc1, 0xd5, 0xc0, 0x31, 0xfb, 0x4b, 0xa1, 0x9c,
+  0xc1, 0x33, 0xba, 0xf8, 0x6d, 0x5e, 0x57, 0x7b, 0xe4, 0xb5, 0x7b, 0xfa, 0x84, 0x3b, 0x4e, 0xe9,
+  0x08, 0x62, 0x5d, 0xcc, 0xd1, 0xc8, 0xe9, 0x7a, 0xdf, 0x50, 0xda, 0xea, 0x2f, 0xf0, 0xc1, 0x68,
+  0x86, 0xc4, 0xd1, 0x55, 0x7b, 0x00, 0xfe, 0x80, 0xcb, 0x34, 0xb3, 0x89, 0x84, 0x81, 0xc7, 0x25,
+  0x92, 0xbf, 0x3f, 0x45, 0xc0, 0x30, 0x84, 0x5f, 0xe2, 0x5d, 0x47, 0x88, 0x81, 0x48, 0xff, 0x53,
+  0x91, 0x0a, 0xae, 0x52, 0x74, 0x0e, 0x36, 0x8d, 0x56, 0x4f, 0x57, 0x98, 0xd1, 0xf7, 0x5d, 0xe0,
+  0xb4, 0x53, 0xca, 0xc1, 0x43, 0x00, 0x0e, 0x3e, 0x5c, 0x2d, 0x85, 0xb8, 0x84, 0xa1, 0xe4, 0x23,
+  0x68, 0xc5, 0xcc, 0xf2, 0x46, 0x66, 0x06, 0xf8, 0x04, 0x2f, 0x2e, 0x58, 0x07, 0x76, 0x1d, 0x45,
+  0x5c, 0x87, 0x80, 0xcb, 0x2b, 0xb2, 0x57, 0x5e, 0xe9, 0x3d, 0x26, 0x48, 0xf8, 0x7b, 0x07, 0xef,
+  0x66, 0xc3, 0xac, 0xe4, 0x57, 0x2f, 0x0c, 0x08, 0x7a, 0x5c, 0xd4, 0x21, 0x7f, 0x18, 0x6f, 0x58,
+  0xd3, 0x5c, 0x88, 0x43, 0xb4, 0x4c, 0xe9, 0xb6, 0xe3, 0x52, 0x03, 0x69, 0x62, 0x17, 0x04, 0xa4,
+  0x80, 0x43, 0x1c, 0x80, 0x50, 0x4a, 0xa2, 0x2e, 0x8f, 0x58, 0xfa, 0x38, 0x82, 0x5f, 0x90, 0x05,
+  0x30, 0x96, 0x14, 0x4a, 0x02, 0x6d, 0x7d, 0x11, 0x3e, 0x45, 0x50, 0xc4, 0x6b, 0x1a, 0x0a, 0xb3,
+  0x7b, 0xc0, 0xb3, 0x9d, 0x80, 0xf8, 0x3e, 0x38, 0xee, 0x6b, 0x69, 0xcb, 0x36, 0x58, 0x8a, 0x32,
+  0xa3, 0xa2, 0x14, 0x82, 0x2a, 0x3a, 0xa1, 0x8a, 0xa3, 0x9b, 0x55, 0x4e, 0xa0, 0xd2, 0x3b, 0xf8,
+  0x40, 0x62, 0xb0, 0x14, 0xe0, 0x12, 0x50, 0xdf, 0x16, 0xf8, 0xa0, 0x5c, 0xbe, 0x41, 0xf7, 0x24,
+  0x8a, 0xb7, 0xe2, 0x4e, 0xfd, 0x9a, 0xb8, 0xee, 0xc4, 0x63, 0x66, 0x7e, 0x90, 0x47, 0x17, 0xe0,
+  0x20, 0xa8, 0x94, 0x6d, 0xa3, 0x93, 0x49, 0xbb, 0xf1, 0xc0, 0xe8, 0x84, 0x34, 0x05, 0x4d, 0x58,
+  0xd8, 0x39, 0xb2, 0x5c, 0x4a, 0x33, 0xe0, 0xb9, 0x4c, 0xb7, 0xcb, 0x18, 0xcd, 0x24, 0x8e, 0x30,
+  0x88, 0xc5, 0xf0, 0x98, 0x53, 0x80, 0x67, 0x5b, 0xc8, 0x85, 0xe1, 0x62, 0xd3, 0x32, 0x20, 0x65,
+  0xab, 0xc1, 0xda, 0xb6, 0x1b, 0xaf, 0xf9, 0x86, 0xaa, 0xe3, 0x60, 0xcf, 0xdb, 0x62, 0x14, 0x69,
+  0x0e, 0x72, 0xdf, 0x3d, 0x2b, 0xc2, 0x9b, 0x1e, 0x6a, 0xa2, 0x08, 0x06, 0x3b, 0xc1, 0xb2, 0x96,
+  0x0d, 0xe1, 0xbe, 0x9c, 0x0c, 0x5c, 0x87, 0xd8, 0x48, 0x11, 0xe3, 0xb2, 0xb4, 0x51, 0xfe, 0x96,
+  0x86, 0xd8, 0x3e, 0x7f, 0x88, 0x08, 0x3e, 0x7a, 0x6e, 0xc2, 0xc8, 0xb9, 0x47, 0x01, 0x37, 0x6a,
+  0x24, 0xc3, 0xcf, 0x4d, 0xc5, 0x19, 0xb0, 0x02, 0x9f, 0x06, 0xa4, 0x73, 0x46, 0xd1, 0xe6, 0x03,
+  0x15, 0x0f, 0x2f, 0x11, 0xc2, 0x60, 0x45, 0xa8, 0x37, 0x7e, 0xdc, 0xe0, 0x87, 0x04, 0xcb, 0x14,
+  0x54, 0xae, 0x52, 0xe2, 0x78, 0x85, 0x22, 0x16, 0x5a, 0x3d, 0xc8, 0x2b, 0xe9, 0xf2, 0xbb, 0x4d,
+  0x47, 0x0b, 0x0b, 0x75, 0x7d, 0x36, 0xfb, 0x80, 0x96, 0x7e, 0x28, 0xc2, 0x18, 0x5c, 0x81, 0x4d,
+  0x20, 0x07, 0x93, 0x56, 0xcb, 0xae, 0x72, 0x46, 0x9a, 0xb0, 0x8a, 0xb0, 0xb4, 0x20, 0x2a, 0xe4,
+  0xa8, 0x17, 0x57, 0xf0, 0xee, 0x53, 0xcc, 0x16, 0x36, 0xb6, 0x26, 0xd0, 0xa5, 0xed, 0xdf, 0x83,
+  0x5e, 0x8f, 0x9d, 0x48, 0xab, 0x82, 0xb9, 0x50, 0x85, 0x13, 0x51, 0x27, 0x3c, 0x94, 0x97, 0x66,
+  0x74, 0x53, 0x03, 0x18, 0x8f, 0xad, 0x85, 0x5d, 0xdd, 0x07, 0x18, 0xd7, 0x1b, 0x61, 0x77, 0x8e,
+  0xe0, 0x4a, 0xdc, 0x7c, 0xc4, 0xe6, 0x82, 0x2b, 0x17, 0x72, 0x43, 0xf7, 0x20, 0x06, 0x29, 0xaa,
+  0xa6, 0xd1, 0x08, 0x8c, 0x37, 0x39, 0x38, 0x0b, 0x59, 0x12, 0xd9, 0x05, 0x04, 0x9b, 0xa4, 0x66,
+  0xc9, 0xe0, 0xff, 0xb7, 0x93, 0x27, 0x8e, 0x2b, 0x4d, 0xfc, 0x8a, 0x5d, 0xe6, 0x8a, 0xa8, 0x64,
+  0x0d, 0x22, 0xe6, 0x1b, 0x02, 0x50, 0x83, 0x4d, 0x01, 0xb9, 0x84, 0xce, 0x47, 0x53, 0x2d, 0x93,
+  0x14, 0x19, 0x6b, 0xd6, 0xb9, 0xc8, 0x2d, 0xfa, 0x9d, 0xe0, 0xde, 0xb4, 0x20, 0x1e, 0x2b, 0x97,
+  0xe3, 0x5b, 0x52, 0xc6, 0x8f, 0x9e, 0x98, 0x9c, 0x38, 0x9c, 0x63, 0x49, 0x99, 0xcc, 0x77, 0x25,
+  0x03, 0xbd, 0x8c, 0x1d, 0x3e, 0x71, 0xcc, 0x8f, 0xe8, 0x45, 0xec, 0x1c, 0x72, 0x38, 0x97, 0xe9,
+  0x4d, 0xc4, 0x52, 0x6c, 0xb5, 0xe7, 0xc8, 0x84, 0xab, 0x8a, 0x7d, 0x35, 0x5f, 0xf0, 0xbf, 0x78,
+  0x2f, 0xd0, 0x7f, 0x0c, 0xf8, 0x0f, 0xf8, 0x6e, 0x5b, 0x76, 0x28, 0x30, 0x00, 0x00
+};
+
+const WebAsset WEB_ASSETS[] = {
+  { "/style.css", "text/css", STYLE_CSS_GZ, sizeof(STYLE_CSS_GZ), "\"b78b146b7cd51fe4\"", "public, max-age=31536000, immutable" },
+  { "/chart.js", "application/javascript", CHART_JS_GZ, sizeof(CHART_JS_GZ), "\"d748e0b704371519\"", "public, max-age=31536000, immutable" },
+  { "/", "text/html; charset=UTF-8", INDEX_HTML_GZ, sizeof(INDEX_HTML_GZ), "\"079d5716cb59c3eb\"", "no-cache" },
+};